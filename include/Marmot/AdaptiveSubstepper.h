@@ -27,7 +27,10 @@
 
 #pragma once
 #include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotTelemetry.h"
 #include "Marmot/MarmotTypedefs.h"
+#include <cmath>
 
 namespace Marmot::NumericalAlgorithms {
 
@@ -44,13 +47,25 @@ namespace Marmot::NumericalAlgorithms {
     /// Vector to carry the internal state of a material
     typedef Eigen::Matrix< double, nIntegrationDependentStateVars, 1 > IntegrationStateVector;
 
+    /** Error estimation of a substep
+     *
+     * Richardson: full step and two half steps with Richardson extrapolation (3 return mappings per accepted substep).
+     *
+     * Embedded: the full step is compared to the stress space predictor extrapolated from the previously accepted
+     * substep, \f$ \varepsilon = \frac{h}{h+h_p} \left\| \Delta\boldsymbol{\sigma} - \frac{h}{h_p}
+     * \Delta\boldsymbol{\sigma}_p \right\| \f$ (1 return mapping per accepted substep), with a PI step size controller.
+     * The first substep, and any substep without a preceding accepted substep, falls back to Richardson.
+     */
+    enum class ErrorEstimator { Richardson, Embedded };
+
     AdaptiveSubstepper( double          initialStepSize,
                         double          minimumStepSize,
                         double          maxScaleUpFactor,
                         double          scaleDownFactor,
                         double          integrationErrorTolerance,
                         int             nPassesToIncrease,
-                        const Matrix6d& Cel );
+                        const Matrix6d& Cel,
+                        ErrorEstimator  errorEstimator = ErrorEstimator::Richardson );
 
     /// Set the current converged state
     void setConvergedProgress( const Marmot::Vector6d& stressOld, const IntegrationStateVector& stateVarsOld );
@@ -78,16 +93,29 @@ namespace Marmot::NumericalAlgorithms {
     /// Write the current results
     void getResults( Marmot::Vector6d& stress, Matrix6d& consistentTangent, IntegrationStateVector& stateVars );
 
+    /// Record the subincrements in the @ref Marmot::Telemetry counters of the given material type
+    void enableTelemetry( const char* materialType );
+
   private:
     const double initialStepSize, minimumStepSize, maxScaleUpFactor, scaleDownFactor, integrationErrorTolerance;
     const int    nPassesToIncrease;
     const bool   ignoreErrorToleranceOnMinimumStepSize;
 
+    const ErrorEstimator errorEstimator;
+
     double currentProgress;
     double currentSubstepSize;
     int    passedSubsteps;
     int    substepIndex;
 
+    /// material type for the telemetry counters, nullptr if disabled
+    const char* telemetryMaterialType;
+
+    /// history of the last accepted substep for the embedded error estimation and the PI controller
+    Marmot::Vector6d lastAcceptedStressIncrement;
+    double           lastAcceptedSubstepSize;
+    double           lastErrorRatio;
+
     /// internal storages for the progress of the total increment
     Marmot::Vector6d       stressProgress;
     IntegrationStateVector stateProgress;
@@ -105,6 +133,10 @@ namespace Marmot::NumericalAlgorithms {
 
     bool acceptSubstepWithFullStepOnly();
     bool splitCurrentSubstep();
+    /// PI step size controller with a smooth (arctan) limiter
+    double computePIScaleFactor( double errorRatio );
+    /// remember an accepted substep for the embedded error estimation
+    void recordAcceptedSubstep( const Marmot::Vector6d& stressIncrement, double errorRatio );
   };
 } // namespace Marmot::NumericalAlgorithms
 
@@ -116,7 +148,8 @@ namespace Marmot::NumericalAlgorithms {
                                                        double          scaleDownFactor,
                                                        double          integrationErrorTolerance,
                                                        int             nPassesToIncrease,
-                                                       const Matrix6d& Cel )
+                                                       const Matrix6d& Cel,
+                                                       ErrorEstimator  errorEstimator )
     : initialStepSize( initialStepSize ),
       minimumStepSize( minimumStepSize ),
       maxScaleUpFactor( maxScaleUpFactor ),
@@ -124,10 +157,15 @@ namespace Marmot::NumericalAlgorithms {
       integrationErrorTolerance( integrationErrorTolerance ),
       nPassesToIncrease( nPassesToIncrease ),
       ignoreErrorToleranceOnMinimumStepSize( true ),
+      errorEstimator( errorEstimator ),
       currentProgress( 0.0 ),
       currentSubstepSize( initialStepSize ),
       passedSubsteps( 0 ),
-      substepIndex( -1 )
+      substepIndex( -1 ),
+      telemetryMaterialType( nullptr ),
+      lastAcceptedStressIncrement( Marmot::Vector6d::Zero() ),
+      lastAcceptedSubstepSize( 0.0 ),
+      lastErrorRatio( 1.0 )
   {
     elasticTangent                       = TangentSizedMatrix::Identity();
     elasticTangent.topLeftCorner( 6, 6 ) = Cel;
@@ -169,6 +207,7 @@ namespace Marmot::NumericalAlgorithms {
       if ( remainingProgress < currentSubstepSize )
         currentSubstepSize = remainingProgress;
       substepIndex++;
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::Substeps );
       return currentSubstepSize;
       break;
     }
@@ -213,6 +252,7 @@ namespace Marmot::NumericalAlgorithms {
     switch ( currentState ) {
     case FullStep: {
       currentSubstepSize *= scaleDownFactor; // we use the scale factor only here
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
       break;
     }
     // these cases should actually never happen, as the full step has already converged!
@@ -229,8 +269,12 @@ namespace Marmot::NumericalAlgorithms {
 
     currentState = FullStep;
 
-    if ( currentSubstepSize < minimumStepSize )
-      return MarmotJournal::warningToMSG( "UMAT: Substepper: Minimal stepzsize reached" );
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
     else
       return true;
   }
@@ -242,9 +286,14 @@ namespace Marmot::NumericalAlgorithms {
     passedSubsteps = 0;
 
     currentSubstepSize *= factorNew; // we use the scale factor only here
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
 
-    if ( currentSubstepSize < minimumStepSize )
-      return MarmotJournal::warningToMSG( "UMAT: Substepper: Minimal stepzsize reached" );
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
     else
       return true;
   }
@@ -254,7 +303,34 @@ namespace Marmot::NumericalAlgorithms {
                                                        const TangentSizedMatrix&     dXdY,
                                                        const IntegrationStateVector& stateVars )
   {
-    if ( currentState == FullStep ) {
+    if ( currentState == FullStep && errorEstimator == ErrorEstimator::Embedded && lastAcceptedSubstepSize > 0 ) {
+      const double           h               = currentSubstepSize;
+      const double           hp              = lastAcceptedSubstepSize;
+      const Marmot::Vector6d stressIncrement = resultStress - stressProgress;
+
+      const double error       = h / ( h + hp ) * ( stressIncrement - h / hp * lastAcceptedStressIncrement ).norm();
+      const double errorRatio  = error / integrationErrorTolerance;
+      const double scaleFactor = computePIScaleFactor( errorRatio );
+
+      if ( error > integrationErrorTolerance &&
+           !( ignoreErrorToleranceOnMinimumStepSize && currentSubstepSize <= minimumStepSize ) ) {
+        passedSubsteps = 0;
+        return repeatSubstep( scaleFactor );
+      }
+
+      consistentTangentProgress += currentSubstepSize * elasticTangent;
+      consistentTangentProgress.applyOnTheLeft( dXdY );
+      stressProgress = resultStress;
+      stateProgress  = stateVars;
+
+      recordAcceptedSubstep( stressIncrement, errorRatio );
+      currentProgress += currentSubstepSize;
+      passedSubsteps++;
+      currentSubstepSize *= scaleFactor;
+
+      return true;
+    }
+    else if ( currentState == FullStep ) {
       stressProgressFullTemp            = resultStress;
       stateProgressFullTemp             = stateVars;
       consistentTangentProgressFullTemp = consistentTangentProgress;
@@ -310,8 +386,14 @@ namespace Marmot::NumericalAlgorithms {
         consistentTangentProgressHalfTemp += 0.5 * currentSubstepSize * elasticTangent;
         consistentTangentProgressHalfTemp.applyOnTheLeft( dXdY );
 
+        if ( errorEstimator == ErrorEstimator::Embedded )
+          scaleFactor = computePIScaleFactor( errorRatio );
+
+        const Marmot::Vector6d stressExtrapolated = 2 * stressProgressHalfTemp - stressProgressFullTemp;
+        recordAcceptedSubstep( stressExtrapolated - stressProgress, errorRatio );
+
         consistentTangentProgress = 2 * consistentTangentProgressHalfTemp - consistentTangentProgressFullTemp;
-        stressProgress            = 2 * stressProgressHalfTemp - stressProgressFullTemp;
+        stressProgress            = stressExtrapolated;
         stateProgress             = 2 * stateProgressHalfTemp - stateProgressFullTemp;
 
         currentProgress += currentSubstepSize;
@@ -334,6 +416,7 @@ namespace Marmot::NumericalAlgorithms {
       // this means, that the complete current cycle is already successfull,
       // as the two half steps must also be elastic!
       consistentTangentProgress += currentSubstepSize * elasticTangent;
+      recordAcceptedSubstep( newStress - stressProgress, lastErrorRatio );
       stressProgress = newStress;
       // no need for two half steps if full step was already elastic
       currentProgress += currentSubstepSize;
@@ -368,6 +451,9 @@ namespace Marmot::NumericalAlgorithms {
   template < size_t n, size_t nState >
   bool AdaptiveSubstepper< n, nState >::acceptSubstepWithFullStepOnly()
   {
+    // no reliable history for the embedded error estimation
+    lastAcceptedSubstepSize = 0.0;
+
     consistentTangentProgress = consistentTangentProgressFullTemp;
     stressProgress            = stressProgressFullTemp;
     stateProgress             = stateProgressFullTemp;
@@ -392,13 +478,50 @@ namespace Marmot::NumericalAlgorithms {
     stressProgressFullTemp            = stressProgressHalfTemp;
     stateProgressFullTemp             = stateProgressHalfTemp;
     currentSubstepSize *= 0.5;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
     currentState = FirstHalfStep;
 
     return true;
   }
+  template < size_t n, size_t nState >
+  double AdaptiveSubstepper< n, nState >::computePIScaleFactor( double errorRatio )
+  {
+    // PI controller for a second order error estimate, exponents 0.7/2 and 0.4/2
+    constexpr double beta1 = 0.35;
+    constexpr double beta2 = 0.2;
+
+    double scaleFactor = 0.9 * std::pow( std::max( errorRatio, 1e-10 ), -beta1 ) *
+                         std::pow( std::max( lastErrorRatio, 1e-10 ), beta2 );
+
+    // smooth limiter instead of hard clamps
+    scaleFactor = 1.0 + std::atan( scaleFactor - 1.0 );
+
+    if ( scaleFactor * currentSubstepSize < minimumStepSize )
+      scaleFactor = minimumStepSize / currentSubstepSize;
+    if ( scaleFactor > maxScaleUpFactor )
+      scaleFactor = maxScaleUpFactor;
+
+    return scaleFactor;
+  }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepper< n, nState >::recordAcceptedSubstep( const Marmot::Vector6d& stressIncrement,
+                                                               double                  errorRatio )
+  {
+    lastAcceptedStressIncrement = stressIncrement;
+    lastAcceptedSubstepSize     = currentSubstepSize;
+    lastErrorRatio              = errorRatio;
+  }
+
   template < size_t n, size_t nState >
   int AdaptiveSubstepper< n, nState >::getNumberOfSubsteps()
   {
     return substepIndex;
   }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepper< n, nState >::enableTelemetry( const char* materialType )
+  {
+    telemetryMaterialType = materialType;
+  }
 } // namespace Marmot::NumericalAlgorithms
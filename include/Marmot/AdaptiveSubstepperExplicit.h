@@ -27,6 +27,8 @@
 
 #pragma once
 #include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotTelemetry.h"
 #include "Marmot/MarmotTypedefs.h"
 
 namespace Marmot::NumericalAlgorithms {
@@ -80,6 +82,9 @@ namespace Marmot::NumericalAlgorithms {
     /// Write the current results
     void getResults( Marmot::Vector6d& stress, Matrix6d& consistentTangent, IntegrationStateVector& stateVars );
 
+    /// Record the subincrements in the @ref Marmot::Telemetry counters of the given material type
+    void enableTelemetry( const char* materialType );
+
   private:
     const double initialStepSize, minimumStepSize, maxScaleUpFactor, scaleDownFactor, integrationErrorTolerance;
     const int    nPassesToIncrease;
@@ -92,6 +97,9 @@ namespace Marmot::NumericalAlgorithms {
     int             substepIndex;
     int             discardedDueToError;
 
+    /// material type for the telemetry counters, nullptr if disabled
+    const char* telemetryMaterialType;
+
     /// internal storages for the progress of the total increment
     Marmot::Vector6d stressProgress;
     /// internal storages for the progress of the total increment
@@ -140,7 +148,8 @@ namespace Marmot::NumericalAlgorithms {
       currentSubstepSize( initialStepSize ),
       passedSubsteps( 0 ),
       substepIndex( -1 ),
-      discardedDueToError( 0 )
+      discardedDueToError( 0 ),
+      telemetryMaterialType( nullptr )
   {
     consistentTangentProgress         = MatrixStateStrain::Zero();
     consistentTangentProgressFullTemp = MatrixStateStrain::Zero();
@@ -202,6 +211,7 @@ namespace Marmot::NumericalAlgorithms {
       if ( remainingProgress < currentSubstepSize )
         currentSubstepSize = remainingProgress;
       substepIndex++;
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::Substeps );
       return currentSubstepSize;
       break;
     }
@@ -246,6 +256,7 @@ namespace Marmot::NumericalAlgorithms {
     switch ( currentState ) {
     case FullStep: {
       currentSubstepSize *= scaleDownFactor; // we use the scale factor only here
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
       break;
     }
     // these cases should actually never happen, as the full step has already converged!
@@ -262,8 +273,12 @@ namespace Marmot::NumericalAlgorithms {
 
     currentState = FullStep;
 
-    if ( currentSubstepSize < minimumStepSize )
-      return MarmotJournal::warningToMSG( "UMAT: Substepper: Minimal stepzsize reached" );
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
     else
       return true;
   }
@@ -275,9 +290,14 @@ namespace Marmot::NumericalAlgorithms {
     passedSubsteps = 0;
 
     currentSubstepSize *= factorNew; // we use the scale factor only here
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
 
-    if ( currentSubstepSize < minimumStepSize )
-      return MarmotJournal::warningToMSG( "UMAT: Substepper: Minimal stepzsize reached" );
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
     else
       return true;
   }
@@ -431,6 +451,7 @@ namespace Marmot::NumericalAlgorithms {
     stressProgressFullTemp            = stressProgressHalfTemp;
     stateProgressFullTemp             = stateProgressHalfTemp;
     currentSubstepSize *= 0.5;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
     currentState = FirstHalfStep;
 
     return true;
@@ -445,4 +466,10 @@ namespace Marmot::NumericalAlgorithms {
   {
     return discardedDueToError;
   }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepperExplicit< n, nState >::enableTelemetry( const char* materialType )
+  {
+    telemetryMaterialType = materialType;
+  }
 } // namespace Marmot::NumericalAlgorithms
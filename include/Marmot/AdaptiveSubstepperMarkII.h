@@ -0,0 +1,414 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+
+#pragma once
+#include "Marmot/MarmotJournal.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotTelemetry.h"
+#include "Marmot/MarmotTypedefs.h"
+#include <utility>
+
+namespace Marmot::NumericalAlgorithms {
+
+  template < size_t materialTangentSize, size_t nIntegrationDependentStateVars >
+  class AdaptiveSubstepperMarkII {
+    /** Adaptive Substepper, employing an error estimation and
+     * Richardson Extrapolation for an Implicit Return Mapping algorithm.
+     *
+     * Same algorithm as AdaptiveSubstepper, but
+     *  - only the strain sensitivity block (materialTangentSize x 6) of the consistent tangent is tracked,
+     *  - the progress, full step and half step storages are double buffered and exchanged by pointer swaps.
+     * */
+  public:
+    /// Matrix for describing the nonlinear equation system of the return mapping algorithm
+    typedef Eigen::Matrix< double, materialTangentSize, materialTangentSize > TangentSizedMatrix;
+    /// Strain sensitivity block of the consistent tangent
+    typedef Eigen::Matrix< double, materialTangentSize, 6 > MatrixStateStrain;
+    /// Vector to carry the internal state of a material
+    typedef Eigen::Matrix< double, nIntegrationDependentStateVars, 1 > IntegrationStateVector;
+
+    AdaptiveSubstepperMarkII( double          initialStepSize,
+                              double          minimumStepSize,
+                              double          maxScaleUpFactor,
+                              double          scaleDownFactor,
+                              double          integrationErrorTolerance,
+                              int             nPassesToIncrease,
+                              const Matrix6d& Cel );
+
+    /// not copyable or movable, as progress, fullTemp and halfTemp point into the own storage
+    AdaptiveSubstepperMarkII( const AdaptiveSubstepperMarkII& )            = delete;
+    AdaptiveSubstepperMarkII( AdaptiveSubstepperMarkII&& )                 = delete;
+    AdaptiveSubstepperMarkII& operator=( const AdaptiveSubstepperMarkII& ) = delete;
+    AdaptiveSubstepperMarkII& operator=( AdaptiveSubstepperMarkII&& )      = delete;
+
+    /// Set the current converged state
+    void setConvergedProgress( const Marmot::Vector6d& stressOld, const IntegrationStateVector& stateVarsOld );
+    /// Check if the subincrementation is finished
+    bool isFinished();
+    /// get the next subincrement size
+    double getNextSubstep();
+    /// get the finished number of subincrements
+    int getNumberOfSubsteps();
+    /// finish a subincrement with plasticity
+    bool finishSubstep( const Marmot::Vector6d&       resultStress,
+                        const TangentSizedMatrix&     dXdY,
+                        const IntegrationStateVector& stateVars );
+    /// finish a subincrement with elasticity only
+    void finishElasticSubstep( const Marmot::Vector6d& resultStress );
+    /// discard the current subincrement
+    bool discardSubstep();
+    /// repeat the current subincrement with a smaller step
+    bool repeatSubstep( double decrementationFactor );
+
+    /// get the last converged state
+    void getConvergedProgress( Marmot::Vector6d& stress, IntegrationStateVector& stateVars );
+    /// Write the current results
+    void getResults( Marmot::Vector6d& stress, Matrix6d& consistentTangent, IntegrationStateVector& stateVars );
+
+    /// Record the subincrements in the @ref Marmot::Telemetry counters of the given material type
+    void enableTelemetry( const char* materialType );
+
+  private:
+    const double initialStepSize, minimumStepSize, maxScaleUpFactor, scaleDownFactor, integrationErrorTolerance;
+    const int    nPassesToIncrease;
+    const bool   ignoreErrorToleranceOnMinimumStepSize;
+
+    double currentProgress;
+    double currentSubstepSize;
+    int    passedSubsteps;
+    int    substepIndex;
+
+    /// material type for the telemetry counters, nullptr if disabled
+    const char* telemetryMaterialType;
+
+    /// stress, state and strain sensitivity of the consistent tangent
+    struct Progress {
+      Marmot::Vector6d       stress;
+      IntegrationStateVector state;
+      MatrixStateStrain      tangent;
+    };
+
+    Progress storage[3];
+    /// the progress of the total increment
+    Progress* progress;
+    /// temporal storages, which are used until a cycle full/half/half has finished successfully
+    Progress *fullTemp, *halfTemp;
+
+    /// strain sensitivity block of the elastic tangent
+    MatrixStateStrain elasticTangent;
+
+    enum SubsteppingState { FullStep, FirstHalfStep, SecondHalfStep };
+    SubsteppingState currentState;
+
+    bool acceptSubstepWithFullStepOnly();
+    bool splitCurrentSubstep();
+  };
+} // namespace Marmot::NumericalAlgorithms
+
+namespace Marmot::NumericalAlgorithms {
+  template < size_t n, size_t nState >
+  AdaptiveSubstepperMarkII< n, nState >::AdaptiveSubstepperMarkII( double          initialStepSize,
+                                                                   double          minimumStepSize,
+                                                                   double          maxScaleUpFactor,
+                                                                   double          scaleDownFactor,
+                                                                   double          integrationErrorTolerance,
+                                                                   int             nPassesToIncrease,
+                                                                   const Matrix6d& Cel )
+    : initialStepSize( initialStepSize ),
+      minimumStepSize( minimumStepSize ),
+      maxScaleUpFactor( maxScaleUpFactor ),
+      scaleDownFactor( scaleDownFactor ),
+      integrationErrorTolerance( integrationErrorTolerance ),
+      nPassesToIncrease( nPassesToIncrease ),
+      ignoreErrorToleranceOnMinimumStepSize( true ),
+      currentProgress( 0.0 ),
+      currentSubstepSize( initialStepSize ),
+      passedSubsteps( 0 ),
+      substepIndex( -1 ),
+      telemetryMaterialType( nullptr ),
+      progress( &storage[0] ),
+      fullTemp( &storage[1] ),
+      halfTemp( &storage[2] )
+  {
+    elasticTangent                       = MatrixStateStrain::Zero();
+    elasticTangent.topLeftCorner( 6, 6 ) = Cel;
+
+    for ( auto& s : storage ) {
+      s.stress.setZero();
+      s.state.setZero();
+      s.tangent.setZero();
+    }
+
+    currentState = FullStep;
+  }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepperMarkII< n, nState >::setConvergedProgress( const Marmot::Vector6d&       stressOld,
+                                                                    const IntegrationStateVector& stateVarsOld )
+  {
+    progress->stress = stressOld;
+    progress->state  = stateVarsOld;
+  }
+
+  template < size_t n, size_t nState >
+  bool AdaptiveSubstepperMarkII< n, nState >::isFinished()
+  {
+    return ( ( 1.0 - currentProgress ) <= 2e-16 && currentState == FullStep );
+  }
+
+  template < size_t n, size_t nState >
+  double AdaptiveSubstepperMarkII< n, nState >::getNextSubstep()
+  {
+    switch ( currentState ) {
+    case FullStep: {
+      const double remainingProgress = 1.0 - currentProgress;
+      if ( remainingProgress < currentSubstepSize )
+        currentSubstepSize = remainingProgress;
+      substepIndex++;
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::Substeps );
+      return currentSubstepSize;
+    }
+    case FirstHalfStep:
+    case SecondHalfStep: return 0.5 * currentSubstepSize;
+    default: return -1.0;
+    }
+  }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepperMarkII< n, nState >::getConvergedProgress( Marmot::Vector6d&       stress,
+                                                                    IntegrationStateVector& stateVars )
+  {
+    const Progress* converged = currentState == SecondHalfStep ? halfTemp : progress;
+    stress                    = converged->stress;
+    stateVars                 = converged->state;
+  }
+
+  template < size_t n, size_t nState >
+  bool AdaptiveSubstepperMarkII< n, nState >::discardSubstep()
+  {
+    passedSubsteps = 0;
+    switch ( currentState ) {
+    case FullStep: {
+      currentSubstepSize *= scaleDownFactor; // we use the scale factor only here
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
+      break;
+    }
+    // these cases should actually never happen, as the full step has already converged!
+    case FirstHalfStep:
+      MarmotJournal::warningToMSG( "UMAT: warning, 1th half sub step has not converged after already "
+                                   "converged full step" );
+      return acceptSubstepWithFullStepOnly();
+
+    case SecondHalfStep:
+      MarmotJournal::warningToMSG( "UMAT: warning, 2th half sub step has not converged after already "
+                                   "converged full step" );
+      return acceptSubstepWithFullStepOnly();
+    }
+
+    currentState = FullStep;
+
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
+    else
+      return true;
+  }
+
+  template < size_t n, size_t nState >
+  bool AdaptiveSubstepperMarkII< n, nState >::repeatSubstep( double factorNew )
+  {
+    currentState   = FullStep;
+    passedSubsteps = 0;
+
+    currentSubstepSize *= factorNew; // we use the scale factor only here
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
+
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
+    else
+      return true;
+  }
+
+  template < size_t n, size_t nState >
+  bool AdaptiveSubstepperMarkII< n, nState >::finishSubstep( const Marmot::Vector6d&       resultStress,
+                                                             const TangentSizedMatrix&     dXdY,
+                                                             const IntegrationStateVector& stateVars )
+  {
+    if ( currentState == FullStep ) {
+      fullTemp->stress            = resultStress;
+      fullTemp->state             = stateVars;
+      fullTemp->tangent.noalias() = dXdY * ( progress->tangent + currentSubstepSize * elasticTangent );
+      currentState                = FirstHalfStep;
+      return true;
+    }
+    else if ( currentState == FirstHalfStep ) {
+      halfTemp->stress            = resultStress;
+      halfTemp->state             = stateVars;
+      halfTemp->tangent.noalias() = dXdY * ( progress->tangent + 0.5 * currentSubstepSize * elasticTangent );
+      currentState                = SecondHalfStep;
+      return true;
+    }
+
+    else if ( currentState == SecondHalfStep ) {
+      // error Estimation
+
+      currentState             = FullStep;
+      const double error       = ( resultStress - fullTemp->stress ).norm();
+      const double errorRatio  = error / integrationErrorTolerance;
+      double       scaleFactor = 1.0;
+      if ( errorRatio > 1e-10 )
+        scaleFactor = 0.9 * std::sqrt( 1. / errorRatio );
+
+      // saturations
+      if ( scaleFactor < 1e-1 )
+        scaleFactor = 1e-1;
+      if ( scaleFactor * currentSubstepSize < minimumStepSize )
+        scaleFactor = minimumStepSize / currentSubstepSize;
+      if ( scaleFactor > maxScaleUpFactor )
+        scaleFactor = maxScaleUpFactor;
+      if ( scaleFactor > 10 )
+        scaleFactor = 10;
+
+      // Error large than tolerance?
+      if ( error > integrationErrorTolerance ) {
+        passedSubsteps = 0;
+        if ( errorRatio < 2 ) {
+          return splitCurrentSubstep();
+        }
+        else {
+          return repeatSubstep( scaleFactor );
+        }
+      }
+      else {
+        // Richardson extrapolation in place of the half step storage, which then becomes the progress
+        halfTemp->tangent = dXdY * ( halfTemp->tangent + 0.5 * currentSubstepSize * elasticTangent );
+        halfTemp->tangent = 2 * halfTemp->tangent - fullTemp->tangent;
+        halfTemp->stress  = 2 * resultStress - fullTemp->stress;
+        halfTemp->state   = 2 * stateVars - fullTemp->state;
+        std::swap( progress, halfTemp );
+
+        currentProgress += currentSubstepSize;
+
+        passedSubsteps++;
+        currentSubstepSize *= scaleFactor;
+
+        return true;
+      }
+    }
+    else
+      return false;
+  }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepperMarkII< n, nState >::finishElasticSubstep( const Marmot::Vector6d& newStress )
+  {
+    switch ( currentState ) {
+    case FullStep: {
+      // this means, that the complete current cycle is already successfull,
+      // as the two half steps must also be elastic!
+      progress->tangent += currentSubstepSize * elasticTangent;
+      progress->stress = newStress;
+      // no need for two half steps if full step was already elastic
+      currentProgress += currentSubstepSize;
+      currentState = FullStep;
+      passedSubsteps++;
+      break;
+    }
+
+    case FirstHalfStep: {
+      halfTemp->tangent = progress->tangent + 0.5 * currentSubstepSize * elasticTangent;
+      halfTemp->stress  = newStress;
+      halfTemp->state   = progress->state;
+      currentState      = SecondHalfStep;
+      break;
+    }
+    case SecondHalfStep: {
+      acceptSubstepWithFullStepOnly();
+      break;
+    }
+    }
+  }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepperMarkII< n, nState >::getResults( Marmot::Vector6d&       stress,
+                                                          Matrix6d&               consistentTangentOperator,
+                                                          IntegrationStateVector& stateVars )
+  {
+    stress                    = progress->stress;
+    stateVars                 = progress->state;
+    consistentTangentOperator = progress->tangent.topRows( 6 );
+  }
+
+  template < size_t n, size_t nState >
+  bool AdaptiveSubstepperMarkII< n, nState >::acceptSubstepWithFullStepOnly()
+  {
+    std::swap( progress, fullTemp );
+
+    currentProgress += currentSubstepSize;
+    currentState = FullStep;
+
+    return true;
+  }
+
+  template < size_t n, size_t nState >
+  bool AdaptiveSubstepperMarkII< n, nState >::splitCurrentSubstep()
+  {
+    if ( currentSubstepSize < 2 * minimumStepSize ) {
+      if ( ignoreErrorToleranceOnMinimumStepSize )
+        return acceptSubstepWithFullStepOnly();
+      else
+        return false;
+    }
+
+    std::swap( fullTemp, halfTemp );
+    currentSubstepSize *= 0.5;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
+    currentState = FirstHalfStep;
+
+    return true;
+  }
+
+  template < size_t n, size_t nState >
+  int AdaptiveSubstepperMarkII< n, nState >::getNumberOfSubsteps()
+  {
+    return substepIndex;
+  }
+
+  template < size_t n, size_t nState >
+  void AdaptiveSubstepperMarkII< n, nState >::enableTelemetry( const char* materialType )
+  {
+    telemetryMaterialType = materialType;
+  }
+} // namespace Marmot::NumericalAlgorithms
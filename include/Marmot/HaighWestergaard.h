@@ -89,6 +89,49 @@ namespace Marmot {
 
       return hw;
     }
+
+    /**
+     * Aggregate of the Haigh-Westergaard coordinates and their derivatives with respect to the stress in \ref
+     * voigtnotation "Voigt notation", as computed by @ref haighWestergaardAndDerivatives.
+     */
+    template < typename T = double >
+    struct HaighWestergaardCoordinatesAndDerivatives {
+
+      /// Haigh-Westergaard coordinates \f$\xi\f$, \f$\rho\f$, \f$\theta\f$
+      HaighWestergaardCoordinates< T > hw;
+
+      /// \f$\frac{d\,\xi}{d\,\boldsymbol{\sigma}}\f$
+      Eigen::Matrix< T, 6, 1 > dXi_dStress;
+      /// \f$\frac{d\,\rho}{d\,\boldsymbol{\sigma}}\f$
+      Eigen::Matrix< T, 6, 1 > dRho_dStress;
+      /// \f$\frac{d\,\theta}{d\,\boldsymbol{\sigma}}\f$
+      Eigen::Matrix< T, 6, 1 > dTheta_dStress;
+
+      /// \f$\frac{d^2\,\rho}{d\,\boldsymbol{\sigma}^2}\f$, only computed if requested
+      Eigen::Matrix< T, 6, 6 > d2Rho_dStress2;
+      /// \f$\frac{d^2\,\theta}{d\,\boldsymbol{\sigma}^2}\f$, only computed if requested
+      Eigen::Matrix< T, 6, 6 > d2Theta_dStress2;
+    };
+
+    /**
+     * Computes the stress coordinates in the Haigh-Westergaard space together with their first and (optionally) second
+     * derivatives with respect to the stress. The deviator and the invariants \f$J_2,\,J_3\f$ are computed only
+     * once and shared by all quantities, which is considerably cheaper than calling @ref haighWestergaard and the
+     * respective functions in VoigtNotation::Derivatives separately.
+     *
+     * \note Singular cases are treated as in VoigtNotation::Derivatives: For \f$\rho \leq 10^{-16}\f$, all
+     * derivatives of \f$\rho\f$ and \f$\theta\f$ are zero; at the meridians (\f$\theta \leq 10^{-15}\f$ or
+     * \f$\theta \geq \pi/3 - 10^{-15}\f$), the derivatives of \f$\theta\f$ are zero. The second derivative of
+     * \f$\xi\f$ vanishes and is not stored.
+     *
+     * @param stress Stress tensor \f$\sig\f$ given in \ref voigtnotation "Voigt notation".
+     * @param computeSecondDerivatives Compute also the second derivatives; otherwise they are left uninitialized.
+     */
+    template < typename T = double >
+    HaighWestergaardCoordinatesAndDerivatives< T > haighWestergaardAndDerivatives(
+      const Eigen::Matrix< T, 6, 1 >& stress,
+      bool                            computeSecondDerivatives = false );
+
     /**
      * Computes the strain coordinates in the Haigh-Westergaard space.
      *
@@ -99,5 +142,121 @@ namespace Marmot {
      */
     HaighWestergaardCoordinates< double > haighWestergaardFromStrain( const Marmot::Vector6d& strain );
 
+    template < typename T >
+    HaighWestergaardCoordinatesAndDerivatives< T > haighWestergaardAndDerivatives(
+      const Eigen::Matrix< T, 6, 1 >& stress,
+      bool                            computeSecondDerivatives )
+    {
+      using namespace Constants;
+      using std::acos;
+      using std::sqrt;
+      typedef Eigen::Matrix< T, 6, 1 > Vector6t;
+      typedef Eigen::Matrix< T, 6, 6 > Matrix6t;
+
+      HaighWestergaardCoordinatesAndDerivatives< T > result;
+      HaighWestergaardCoordinates< T >&              hw = result.hw;
+
+      const T I1_ = stress( 0 ) + stress( 1 ) + stress( 2 );
+      const T p   = I1_ / 3.;
+
+      // deviator s, and the Voigt vector of s * s
+      Vector6t s = stress;
+      s.template head< 3 >().array() -= p;
+
+      Vector6t ss;
+      ss << s( 0 ) * s( 0 ) + s( 3 ) * s( 3 ) + s( 4 ) * s( 4 ), s( 3 ) * s( 3 ) + s( 1 ) * s( 1 ) + s( 5 ) * s( 5 ),
+        s( 4 ) * s( 4 ) + s( 5 ) * s( 5 ) + s( 2 ) * s( 2 ), s( 0 ) * s( 3 ) + s( 3 ) * s( 1 ) + s( 4 ) * s( 5 ),
+        s( 0 ) * s( 4 ) + s( 3 ) * s( 5 ) + s( 4 ) * s( 2 ), s( 3 ) * s( 4 ) + s( 1 ) * s( 5 ) + s( 5 ) * s( 2 );
+
+      const T J2_ = 0.5 * ( ss( 0 ) + ss( 1 ) + ss( 2 ) );
+      const T J3_ = ( s( 0 ) * ss( 0 ) + s( 3 ) * ss( 3 ) + s( 4 ) * ss( 4 ) ) / 3. +
+                    ( s( 3 ) * ss( 3 ) + s( 1 ) * ss( 1 ) + s( 5 ) * ss( 5 ) ) / 3. +
+                    ( s( 4 ) * ss( 4 ) + s( 5 ) * ss( 5 ) + s( 2 ) * ss( 2 ) ) / 3.;
+
+      hw.xi  = I1_ / sqrt3;
+      hw.rho = sqrt( T( 2. * J2_ ) );
+
+      result.dXi_dStress << 1. / sqrt3, 1. / sqrt3, 1. / sqrt3, 0, 0, 0;
+      result.dRho_dStress.setZero();
+      result.dTheta_dStress.setZero();
+      if ( computeSecondDerivatives ) {
+        result.d2Rho_dStress2.setZero();
+        result.d2Theta_dStress2.setZero();
+      }
+
+      if ( Marmot::Math::makeReal( hw.rho ) <= 1e-16 ) {
+        hw.theta = 0.;
+        return result;
+      }
+
+      const T x = 3. * ( sqrt3 / 2. ) * J3_ / ( J2_ * sqrt( J2_ ) );
+      if ( Marmot::Math::makeReal( x ) <= -1 || x != x )
+        hw.theta = 1. / 3 * Pi;
+      else if ( Marmot::Math::makeReal( x ) >= 1 )
+        hw.theta = 0.;
+      else
+        hw.theta = 1. / 3 * acos( x );
+
+      // dJ2/dσ = P∘s, dJ3/dσ = IDev (P∘(s s))
+      Vector6t dJ2 = s;
+      dJ2.template tail< 3 >() *= 2.;
+      Vector6t dJ3 = ss;
+      dJ3.template tail< 3 >() *= 2.;
+      dJ3.template head< 3 >().array() -= 2. / 3 * J2_;
+
+      result.dRho_dStress = dJ2 / hw.rho;
+
+      // d²J2/dσ² = P∘IDev
+      Matrix6t d2J2 = Matrix6t::Zero();
+      if ( computeSecondDerivatives ) {
+        d2J2.template topLeftCorner< 3, 3 >().setConstant( -1. / 3 );
+        d2J2.diagonal() << 2. / 3, 2. / 3, 2. / 3, 2., 2., 2.;
+        result.d2Rho_dStress2 = ( d2J2 - result.dRho_dStress * result.dRho_dStress.transpose() ) / hw.rho;
+      }
+
+      const double theta = Marmot::Math::makeReal( hw.theta );
+      if ( theta <= 1e-15 || theta >= Pi / 3 - 1e-15 )
+        return result;
+
+      // θ = acos( x ) / 3 with x = 3√3/2 J3 / J2^(3/2)
+      const T sqrtJ2_3     = J2_ * sqrt( J2_ );
+      const T sin3Theta    = sqrt( T( 1. - x * x ) );
+      const T dTheta_dx    = -1. / ( 3. * sin3Theta );
+      const T dx_dJ3       = 3. * ( sqrt3 / 2. ) / sqrtJ2_3;
+      const T dx_dJ2       = -1.5 * x / J2_;
+      const Vector6t dx    = dx_dJ2 * dJ2 + dx_dJ3 * dJ3;
+      result.dTheta_dStress = dTheta_dx * dx;
+
+      if ( !computeSecondDerivatives )
+        return result;
+
+      // Hessian of J3 with respect to the Voigt components of s, projected by IDev from both sides
+      Matrix6t d2J3_ds2;
+      // clang-format off
+      d2J3_ds2 <<
+        0,          s( 2 ),     s( 1 ),     0,          0,          -2 * s( 5 ),
+        s( 2 ),     0,          s( 0 ),     0,          -2 * s( 4 ), 0,
+        s( 1 ),     s( 0 ),     0,          -2 * s( 3 ), 0,          0,
+        0,          0,          -2 * s( 3 ), -2 * s( 2 ), 2 * s( 5 ), 2 * s( 4 ),
+        0,          -2 * s( 4 ), 0,          2 * s( 5 ), -2 * s( 1 ), 2 * s( 3 ),
+        -2 * s( 5 ), 0,          0,          2 * s( 4 ), 2 * s( 3 ), -2 * s( 0 );
+      // clang-format on
+      Matrix6t d2J3 = d2J3_ds2;
+      const Eigen::Matrix< T, 1, 6 > meanRows = d2J3.template topRows< 3 >().colwise().sum() / 3.;
+      d2J3.template topRows< 3 >().rowwise() -= meanRows;
+      const Eigen::Matrix< T, 6, 1 > meanCols = d2J3.template leftCols< 3 >().rowwise().sum() / 3.;
+      d2J3.template leftCols< 3 >().colwise() -= meanCols;
+
+      const T d2x_dJ2dJ3 = -1.5 * dx_dJ3 / J2_;
+      const T d2x_dJ2dJ2 = 3.75 * x / ( J2_ * J2_ );
+      const Matrix6t d2x = dx_dJ2 * d2J2 + dx_dJ3 * d2J3 + d2x_dJ2dJ2 * dJ2 * dJ2.transpose() +
+                           d2x_dJ2dJ3 * ( dJ2 * dJ3.transpose() + dJ3 * dJ2.transpose() );
+
+      const T d2Theta_dx2 = dTheta_dx * x / ( 1. - x * x );
+      result.d2Theta_dStress2 = dTheta_dx * d2x + d2Theta_dx2 * dx * dx.transpose();
+
+      return result;
+    }
+
   } // namespace ContinuumMechanics::HaighWestergaard
 } // namespace Marmot
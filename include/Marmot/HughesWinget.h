@@ -42,9 +42,27 @@ namespace Marmot::NumericalAlgorithms {
     Eigen::Matrix3d  getRotationIncrement();
     Marmot::Vector6d rotateTensor( const Marmot::Vector6d& tensor );
 
+    /// Reference implementation of the algorithmic tangent \f$\frac{\partial\boldsymbol{\sigma}}{\partial
+    /// \boldsymbol{F}}\f$ based on the full contraction with @ref dOmega_dVelocityGradient and @ref
+    /// dStretchingRate_dVelocityGradient
     Marmot::EigenTensors::Tensor633d compute_dS_dF( const Marmot::Vector6d& stress,
                                                     const Eigen::Matrix3d&  FInv,
                                                     const Marmot::Matrix6d& dChauchyDEps );
+
+    /**
+     * Compute the algorithmic tangent \f$\frac{\partial\boldsymbol{\sigma}}{\partial\boldsymbol{F}}\f$ directly
+     * into a 6x3x3 buffer (column major), exploiting the sparsity of the derivatives of the stretching rate and the
+     * spin with respect to the velocity gradient:
+     *
+     * \f[ \frac{\partial \sigma_{ij}}{\partial l_{kl}} = \mathbb{C}_{ij(kl)} + \frac{1}{2} \left(
+     * \delta_{ik}\,\sigma_{lj} - \delta_{il}\,\sigma_{kj} + \delta_{jk}\,\sigma_{il} - \delta_{jl}\,\sigma_{ik}
+     * \right), \qquad \frac{\partial \sigma_{ij}}{\partial F_{kL}} = \frac{\partial \sigma_{ij}}{\partial l_{km}}
+     * F^{-1}_{Lm} \f]
+     */
+    void compute_dS_dF( double*                 dS_dF,
+                        const Marmot::Vector6d& stress,
+                        const Eigen::Matrix3d&  FInv,
+                        const Marmot::Matrix6d& dChauchyDEps );
     Eigen::Matrix3d compute_dScalar_dF( const Eigen::Matrix3d& FInv, const Marmot::Vector6d& dScalarDEps );
 
   private:
@@ -54,4 +72,197 @@ namespace Marmot::NumericalAlgorithms {
     Eigen::Matrix3d  dR;
     Marmot::Vector6d dEps;
   };
+
+  /**
+   * Hughes-Winget kinematics for a pack of nLanes quadrature points at once.
+   *
+   * All quantities are stored in structure-of-arrays layout, i.e., the component \f$c\f$ (column major for 3x3
+   * tensors, Voigt notation for symmetric tensors) of lane \f$p\f$ is located at \f$c\,n_{\rm Lanes} + p\f$. Each
+   * component is processed as one Eigen packet, such that the packs map to AVX2 (nLanes = 4) or AVX-512 (nLanes = 8)
+   * registers if the respective instruction set is enabled.
+   *
+   * The arithmetic sequence is shared with @ref HughesWinget (see @ref computeHughesWingetKinematics), hence the
+   * results are bit-identical to the scalar class as long as the compiler does not contract floating point
+   * operations differently in the scalar and the vectorized code (e.g., -ffp-contract=off). As for the scalar class,
+   * HughesWinget::AbaqusLike is the only available formulation.
+   */
+  template < int nLanes >
+  class HughesWingetBatch {
+  public:
+    static_assert( nLanes > 0, "HughesWingetBatch requires at least one lane" );
+
+    /// A pack of one tensor component for all lanes
+    typedef Eigen::Array< double, nLanes, 1 > Lanes;
+
+    HughesWingetBatch( const double* FOld, const double* FNew, HughesWinget::Formulation formulation );
+
+    /// Write the strain increments (6 x nLanes) in Voigt notation
+    void getStrainIncrements( double* dEps ) const;
+    /// Write the rotation increments \f$\Delta\boldsymbol{\Omega}\f$ (9 x nLanes)
+    void getRotationIncrements( double* dOmega ) const;
+    /// Rotate the stresses (6 x nLanes) given in Voigt notation in place
+    void rotateTensors( double* stress ) const;
+
+  private:
+    Lanes l[9];
+    Lanes dOmega[9];
+    Lanes dR[9];
+    Lanes dEps[6];
+  };
+
+  /**
+   * Compute the velocity gradient \f$\boldsymbol{l}\,\Delta t\f$, the strain increment (Voigt notation), the rotation
+   * increment \f$\Delta\boldsymbol{\Omega}\f$ and the incremental rotation \f$\Delta\boldsymbol{R}\f$ by means of
+   * the Hughes-Winget algorithm, using explicit cofactor inverses of the 3x3 matrices.
+   *
+   * T is either double or a pack of lanes (Eigen::Array), all 3x3 tensors are stored column major.
+   */
+  template < typename T >
+  void computeHughesWingetKinematics( const T* FOld, const T* FNew, T* l, T* dEps, T* dOmega, T* dR );
+
+  /// Compute \f$\Delta\boldsymbol{R}\cdot\boldsymbol{\sigma}\cdot\Delta\boldsymbol{R}^T\f$ in place for a stress
+  /// in Voigt notation; T is either double or a pack of lanes (Eigen::Array).
+  template < typename T >
+  void rotateVoigtStressHughesWinget( const T* dR, T* stress );
+
+} // namespace Marmot::NumericalAlgorithms
+
+namespace Marmot::NumericalAlgorithms {
+
+  /// Helpers of the Hughes-Winget kernels (explicit 3x3 algebra for double and packs of lanes), not part of the API
+  namespace HughesWingetDetail {
+
+    template < typename T >
+    void invert3x3( const T* A, T* AInv )
+    {
+      // cofactors, A(i,j) = A[i + 3j]
+      const T c00 = A[4] * A[8] - A[7] * A[5];
+      const T c01 = A[7] * A[2] - A[1] * A[8];
+      const T c02 = A[1] * A[5] - A[4] * A[2];
+
+      const T invDet = 1. / ( A[0] * c00 + A[3] * c01 + A[6] * c02 );
+
+      AInv[0] = c00 * invDet;
+      AInv[1] = c01 * invDet;
+      AInv[2] = c02 * invDet;
+      AInv[3] = ( A[6] * A[5] - A[3] * A[8] ) * invDet;
+      AInv[4] = ( A[0] * A[8] - A[6] * A[2] ) * invDet;
+      AInv[5] = ( A[3] * A[2] - A[0] * A[5] ) * invDet;
+      AInv[6] = ( A[3] * A[7] - A[6] * A[4] ) * invDet;
+      AInv[7] = ( A[6] * A[1] - A[0] * A[7] ) * invDet;
+      AInv[8] = ( A[0] * A[4] - A[3] * A[1] ) * invDet;
+    }
+
+    template < typename T >
+    void multiply3x3( const T* A, const T* B, T* AB )
+    {
+      for ( int j = 0; j < 3; j++ )
+        for ( int i = 0; i < 3; i++ )
+          AB[i + 3 * j] = A[i] * B[3 * j] + A[i + 3] * B[1 + 3 * j] + A[i + 6] * B[2 + 3 * j];
+    }
+
+  } // namespace HughesWingetDetail
+
+  template < typename T >
+  void computeHughesWingetKinematics( const T* FOld, const T* FNew, T* l, T* dEps, T* dOmega, T* dR )
+  {
+    T FMidStep[9], FMidStepInv[9], dF[9];
+    for ( int i = 0; i < 9; i++ ) {
+      FMidStep[i] = 0.5 * ( FNew[i] + FOld[i] );
+      dF[i]       = FNew[i] - FOld[i];
+    }
+
+    HughesWingetDetail::invert3x3( FMidStep, FMidStepInv );
+    HughesWingetDetail::multiply3x3( dF, FMidStepInv, l ); // actually l * dT
+
+    // actually d * dT in Voigt notation
+    dEps[0] = l[0];
+    dEps[1] = l[4];
+    dEps[2] = l[8];
+    dEps[3] = l[3] + l[1];
+    dEps[4] = l[6] + l[2];
+    dEps[5] = l[7] + l[5];
+
+    // actually omega * dT
+    dOmega[0] = 0. * l[0];
+    dOmega[4] = 0. * l[4];
+    dOmega[8] = 0. * l[8];
+    dOmega[3] = 0.5 * ( l[3] - l[1] );
+    dOmega[6] = 0.5 * ( l[6] - l[2] );
+    dOmega[7] = 0.5 * ( l[7] - l[5] );
+    dOmega[1] = -dOmega[3];
+    dOmega[2] = -dOmega[6];
+    dOmega[5] = -dOmega[7];
+
+    // dR = ( I - 0.5 dOmega )^-1 ( I + 0.5 dOmega )
+    constexpr double I[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    T                A[9], AInv[9], B[9];
+    for ( int i = 0; i < 9; i++ ) {
+      A[i] = I[i] - 0.5 * dOmega[i];
+      B[i] = I[i] + 0.5 * dOmega[i];
+    }
+
+    HughesWingetDetail::invert3x3( A, AInv );
+    HughesWingetDetail::multiply3x3( AInv, B, dR );
+  }
+
+  template < typename T >
+  void rotateVoigtStressHughesWinget( const T* dR, T* stress )
+  {
+    // clang-format off
+    const T S[9] = { stress[0], stress[3], stress[4],
+                     stress[3], stress[1], stress[5],
+                     stress[4], stress[5], stress[2] };
+    // clang-format on
+    T dRS[9];
+    HughesWingetDetail::multiply3x3( dR, S, dRS );
+
+    // ( dR * S ) * dR^T, only the upper triangle
+    constexpr int voigtI[6] = { 0, 1, 2, 0, 0, 1 };
+    constexpr int voigtJ[6] = { 0, 1, 2, 1, 2, 2 };
+    for ( int ij = 0; ij < 6; ij++ ) {
+      const int i = voigtI[ij];
+      const int j = voigtJ[ij];
+      stress[ij]  = dRS[i] * dR[j] + dRS[i + 3] * dR[j + 3] + dRS[i + 6] * dR[j + 6];
+    }
+  }
+
+  template < int nLanes >
+  HughesWingetBatch< nLanes >::HughesWingetBatch( const double* FOld, const double* FNew, HughesWinget::Formulation )
+  {
+    Lanes FOld_[9], FNew_[9];
+    for ( int i = 0; i < 9; i++ ) {
+      FOld_[i] = Eigen::Map< const Lanes >( FOld + i * nLanes );
+      FNew_[i] = Eigen::Map< const Lanes >( FNew + i * nLanes );
+    }
+
+    computeHughesWingetKinematics( FOld_, FNew_, l, dEps, dOmega, dR );
+  }
+
+  template < int nLanes >
+  void HughesWingetBatch< nLanes >::getStrainIncrements( double* dEps_ ) const
+  {
+    for ( int i = 0; i < 6; i++ )
+      Eigen::Map< Lanes >( dEps_ + i * nLanes ) = dEps[i];
+  }
+
+  template < int nLanes >
+  void HughesWingetBatch< nLanes >::getRotationIncrements( double* dOmega_ ) const
+  {
+    for ( int i = 0; i < 9; i++ )
+      Eigen::Map< Lanes >( dOmega_ + i * nLanes ) = dOmega[i];
+  }
+
+  template < int nLanes >
+  void HughesWingetBatch< nLanes >::rotateTensors( double* stress ) const
+  {
+    Lanes stress_[6];
+    for ( int i = 0; i < 6; i++ )
+      stress_[i] = Eigen::Map< const Lanes >( stress + i * nLanes );
+
+    rotateVoigtStressHughesWinget( dR, stress_ );
+
+    for ( int i = 0; i < 6; i++ )
+      Eigen::Map< Lanes >( stress + i * nLanes ) = stress_[i];
+  }
 } // namespace Marmot::NumericalAlgorithms
@@ -29,7 +29,12 @@
 #include "Marmot/MarmotNumericalIntegration.h"
 #include "Marmot/MarmotTypedefs.h"
 #include "autodiff/forward/real.hpp"
+#include <array>
 #include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <vector>
 
 namespace Marmot::Materials {
 
@@ -63,64 +68,221 @@ namespace Marmot::Materials {
       return val;
     }
 
+    /**
+     * Approximate the compliance of the units with retardation times below \f$ \tau_{min}/\sqrt{10} \f$ from the
+     * retardation spectrum \f$ L(\tau) \f$ of the Post-Widder formula, i.e.,
+     * \f$ \int_0^{\tau_{min}/\sqrt{10}} L(\tau)\, d\ln\tau \f$.
+     *
+     * The integral is computed with respect to \f$ \ln\tau \f$, for which the integrand is smooth, whereas
+     * \f$ L(\tau)/\tau \f$ is singular at \f$ \tau \to 0 \f$ for the usual power law type compliance functions.
+     */
     template < int k >
     double approximateZerothCompliance( std::function< autodiff::Real< k, double >( autodiff::Real< k, double > ) > phi,
                                         double tauMin )
     {
-      NumericalAlgorithms::Integration::scalar_to_scalar_function_type f = [&]( double tau ) {
-        double                      val_ = -pow( k, k ) * pow( -tau, k - 1 ) / double( Factorial< k - 1 >::value );
+      NumericalAlgorithms::Integration::scalar_to_scalar_function_type f = [&]( double lnTau ) {
+        const double                tau  = exp( lnTau );
+        double                      val_ = -pow( k, k ) * pow( -tau, k ) / double( Factorial< k - 1 >::value );
         autodiff::Real< k, double > tau_( tau * k );
         val_ *= autodiff::derivatives( phi, autodiff::along( 1. ), autodiff::at( tau_ ) )[k];
         return val_;
       };
 
-      double
-        val = NumericalAlgorithms::Integration::integrateScalarFunction( f,
-                                                                         { 1e-14, tauMin / sqrt( 10. ) },
-                                                                         100,
-                                                                         NumericalAlgorithms::Integration::simpson );
+      const double lnTauLower = log( 1e-14 );
+      const double lnTauUpper = log( tauMin / sqrt( 10. ) );
+
+      double val = NumericalAlgorithms::Integration::integrateScalarFunction( f,
+                                                                             { lnTauLower, lnTauUpper },
+                                                                             20,
+                                                                             NumericalAlgorithms::Integration::simpson );
       return val;
     }
 
+    /**
+     * Evaluate the Post-Widder formula for several retardation times at once, sharing the constant factors.
+     */
     template < int k >
-    Properties computeElasticModuli( std::function< autodiff::Real< k, double >( autodiff::Real< k, double > ) > phi,
-                                     Properties retardationTimes,
-                                     bool       gaussQuadrature = false )
+    Properties evaluatePostWidderFormula(
+      std::function< autodiff::Real< k, double >( autodiff::Real< k, double > ) > phi,
+      const Eigen::Ref< const Properties >&                                       retardationTimes )
     {
-      Properties elasticModuli( retardationTimes.size() );
-      double     spacing = log( retardationTimes( 1 ) / retardationTimes( 0 ) );
+      const double factor = pow( k, k ) / double( Factorial< k - 1 >::value );
 
+      Properties spectrum( retardationTimes.size() );
       for ( int i = 0; i < retardationTimes.size(); i++ ) {
-        double tau = retardationTimes( i );
-        if ( !gaussQuadrature )
-          elasticModuli( i ) = 1. / ( spacing * evaluatePostWidderFormula< k >( phi, tau ) );
-        else
-          elasticModuli( i ) = 1. / ( spacing / 2. *
-                                      ( evaluatePostWidderFormula< k >( phi, tau * pow( 10., -sqrt( 3. ) / 6. ) ) +
-                                        evaluatePostWidderFormula< k >( phi, tau * pow( 10., sqrt( 3. ) / 6. ) ) ) );
+        const double                tau = retardationTimes( i );
+        autodiff::Real< k, double > tau_( tau * k );
+        spectrum( i ) = -factor * pow( -tau, k ) *
+                        autodiff::derivatives( phi, autodiff::along( 1. ), autodiff::at( tau_ ) )[k];
       }
 
-      return elasticModuli;
+      return spectrum;
+    }
+
+    template < int k >
+    Properties computeElasticModuli( std::function< autodiff::Real< k, double >( autodiff::Real< k, double > ) > phi,
+                                     const Eigen::Ref< const Properties >& retardationTimes,
+                                     bool                                  gaussQuadrature = false )
+    {
+      const double spacing = log( retardationTimes( 1 ) / retardationTimes( 0 ) );
+
+      if ( !gaussQuadrature )
+        return ( spacing * evaluatePostWidderFormula< k >( phi, retardationTimes ).array() ).inverse();
+
+      // both Gauss points of all units are evaluated in a single batch
+      const Eigen::Index n     = retardationTimes.size();
+      const double       shift = pow( 10., sqrt( 3. ) / 6. );
+      Properties         gaussPoints( 2 * n );
+      gaussPoints.head( n ) = retardationTimes / shift;
+      gaussPoints.tail( n ) = retardationTimes * shift;
+
+      const Properties spectrum = evaluatePostWidderFormula< k >( phi, gaussPoints );
+      return ( spacing / 2. * ( spectrum.head( n ) + spectrum.tail( n ) ).array() ).inverse();
     }
 
+    /**
+     * Fit the elastic moduli of a Kelvin chain and the zeroth compliance \f$ J_0 \f$ to a compliance function
+     * \f$ \phi(t) \f$ by non-negative least squares,
+     *
+     * \f[ \phi(t_j) \approx J_0 + \sum_i \frac{1}{D_i} \left( 1 - e^{-t_j/\tau_i} \right), \f]
+     *
+     * at logarithmically spaced times \f$ t_j \f$ between the shortest and the longest retardation time. In contrast
+     * to the Post-Widder formula, only values of \f$ \phi \f$ (but no derivatives) are required. Units with a
+     * vanishing compliance are assigned an infinite modulus.
+     *
+     * @param samplesPerUnit Number of sampling times per unit
+     */
+    Properties fitElasticModuli( const std::function< double( double ) >& phi,
+                                 const Eigen::Ref< const Properties >&    retardationTimes,
+                                 double&                                  zerothCompliance,
+                                 int                                      samplesPerUnit = 4 );
+
+    /**
+     * Cache of fitted Kelvin chains, for materials whose compliance function varies per element (e.g., age dependent
+     * concrete), but takes only a limited number of distinct parameter sets.
+     *
+     * Chains are keyed by the parameters of the compliance function and the retardation times; the caller is
+     * responsible that they identify the chain uniquely (e.g., including the order of the Post-Widder formula, if it
+     * varies). The cache is thread safe; the fit itself is computed without holding the lock.
+     */
+    class FittedChainCache {
+
+    public:
+      struct Chain {
+        Properties elasticModuli;
+        double     zerothCompliance;
+      };
+
+      /// Get the chain for the given parameters, or compute it by fit and store it
+      const Chain& get( const std::vector< double >&          complianceParameters,
+                        const Eigen::Ref< const Properties >& retardationTimes,
+                        const std::function< Chain() >&       fit );
+
+    private:
+      std::mutex                                mutex;
+      std::map< std::vector< double >, Chain > chains;
+    };
+
     Properties generateRetardationTimes( int n, double min, double spacing );
 
-    void updateStateVarMatrix( const double                 dT,
-                               Properties                   elasticModuli,
-                               Properties                   retardationTimes,
-                               Eigen::Ref< StateVarMatrix > stateVars,
-                               const Marmot::Vector6d&      dStress,
-                               const Marmot::Matrix6d&      unitComplianceMatrix );
-
-    void evaluateKelvinChain( const double      dT,
-                              Properties        elasticModuli,
-                              Properties        retardationTimes,
-                              StateVarMatrix    stateVars,
-                              double&           uniaxialCompliance,
-                              Marmot::Vector6d& dStrain,
-                              const double      factor );
+    /**
+     * Update the internal variables of all units of a Kelvin chain, i.e., the strains per unit stress in the
+     * exponential algorithm according to Jirasek & Bazant.
+     */
+    void updateStateVarMatrix( const double                          dT,
+                               const Eigen::Ref< const Properties >& elasticModuli,
+                               const Eigen::Ref< const Properties >& retardationTimes,
+                               Eigen::Ref< StateVarMatrix >          stateVars,
+                               const Marmot::Vector6d&               dStress,
+                               const Marmot::Matrix6d&               unitComplianceMatrix );
+
+    /**
+     * Add the contribution of a Kelvin chain to the uniaxial compliance and to the strain increment (both scaled by
+     * factor).
+     */
+    void evaluateKelvinChain( const double                              dT,
+                              const Eigen::Ref< const Properties >&     elasticModuli,
+                              const Eigen::Ref< const Properties >&     retardationTimes,
+                              const Eigen::Ref< const StateVarMatrix >& stateVars,
+                              double&                                   uniaxialCompliance,
+                              Marmot::Vector6d&                         dStrain,
+                              const double                              factor );
 
     void computeLambdaAndBeta( double dT, double tau, double& lambda, double& beta );
 
+    /**
+     * Compute the coefficients lambda and beta of all units at once; the exponentials are evaluated vectorized.
+     *
+     * @param lambda, beta Output, with the size of retardationTimes
+     */
+    void computeLambdaAndBeta( double                                dT,
+                               const Eigen::Ref< const Properties >& retardationTimes,
+                               Eigen::Ref< Properties >              lambda,
+                               Eigen::Ref< Properties >              beta );
+
+    /**
+     * Coefficients lambda and beta of all units of a Kelvin chain for a time increment dT.
+     *
+     * The coefficients are intended to be owned by the caller and refreshed once per (sub)increment by @ref update,
+     * which reuses the memory as long as the number of units does not change.
+     */
+    struct Coefficients {
+      Coefficients() = default;
+      Coefficients( double dT, const Eigen::Ref< const Properties >& retardationTimes );
+
+      /// Recompute the coefficients for the given time increment and retardation times
+      void update( double dT, const Eigen::Ref< const Properties >& retardationTimes );
+
+      /// Check if the coefficients belong to the given time increment and retardation times
+      bool matches( double dT, const Eigen::Ref< const Properties >& retardationTimes ) const;
+
+      /// NaN for default constructed coefficients, which hence match no time increment
+      double     dT = std::numeric_limits< double >::quiet_NaN();
+      Properties retardationTimes;
+      Properties lambda;
+      Properties beta;
+    };
+
+    /**
+     * Small cache of the coefficients of a Kelvin chain for the most recently used time increments and retardation
+     * times.
+     *
+     * Within an increment, all quadrature points of a material share the same retardation times, and (also under
+     * adaptive substepping) only a few distinct time increments recur, hence the exponentials have to be evaluated only
+     * once per distinct time increment. The cache is not synchronized; it is intended to be owned by a single thread
+     * (e.g., as thread_local variable), such that a lookup neither locks nor touches atomics. On a miss, the oldest
+     * entry is recomputed in place, such that no memory is allocated once all entries have been used.
+     */
+    class CoefficientCache {
+
+    public:
+      static constexpr int nEntries = 4;
+
+      /**
+       * Get the coefficients for the given time increment and retardation times, and update the cache if required. The
+       * returned reference stays valid until nEntries further misses.
+       */
+      const Coefficients& get( double dT, const Eigen::Ref< const Properties >& retardationTimes );
+
+    private:
+      std::array< Coefficients, nEntries > entries;
+      int                                  oldest = 0;
+    };
+
+    /// @ref evaluateKelvinChain with precomputed coefficients
+    void evaluateKelvinChain( const Coefficients&                       coefficients,
+                              const Eigen::Ref< const Properties >&     elasticModuli,
+                              const Eigen::Ref< const StateVarMatrix >& stateVars,
+                              double&                                   uniaxialCompliance,
+                              Marmot::Vector6d&                         dStrain,
+                              const double                              factor );
+
+    /// @ref updateStateVarMatrix with precomputed coefficients
+    void updateStateVarMatrix( const Coefficients&                   coefficients,
+                               const Eigen::Ref< const Properties >& elasticModuli,
+                               Eigen::Ref< StateVarMatrix >          stateVars,
+                               const Marmot::Vector6d&               dStress,
+                               const Marmot::Matrix6d&               unitComplianceMatrix );
+
   } // namespace KelvinChain
 } // namespace Marmot::Materials
@@ -26,7 +26,11 @@
  * ---------------------------------------------------------------------
  */
 #pragma once
+#include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotTelemetry.h"
 #include "Marmot/MarmotVoigt.h"
+#include <cmath>
+#include <limits>
 
 namespace Marmot::ContinuumMechanics {
 
@@ -101,4 +105,252 @@ namespace Marmot::ContinuumMechanics {
      */
     Eigen::Matrix< double, 3, 6 > dStressPlaneStressDStress();
   } // namespace PlaneStress
+
+  /**
+   * Generic condensation engine for lower dimensional stress states (plane stress and uniaxial stress) shared by all
+   * material families.
+   *
+   * For a set of unknowns \f$\boldsymbol{x}\f$ (e.g., out-of-plane strain increments or deformation gradient
+   * components), the constrained stress components are driven to their target values by Newton's method.
+   *
+   * \note Generalized plane strain, which prescribes the out-of-plane strain rather than a stress component, is not
+   * covered.
+   */
+  namespace Condensation {
+
+    /// Tolerances, iteration limits and line search settings of the condensation iteration
+    struct Options {
+      /// converged if the sum of the absolute residuals falls below
+      double residualTolerance;
+      /// relaxed tolerance, which is accepted after iterationsBeforeRelaxedTolerance iterations
+      double relaxedResidualTolerance;
+      int    iterationsBeforeRelaxedTolerance;
+      /// maximum number of material evaluations before giving up
+      int maxIterations;
+      /// bisect the Newton step as long as the residual increases
+      bool lineSearch;
+      int  maxLineSearchSteps;
+    };
+
+    /// The @ref Marmot::Telemetry counters, by which a condensation reports its calls and material evaluations
+    struct TelemetryCounters {
+      Telemetry::Counter calls;
+      Telemetry::Counter evaluations;
+    };
+
+    constexpr TelemetryCounters planeStressTelemetry   = { Telemetry::Counter::PlaneStressCalls,
+                                                         Telemetry::Counter::PlaneStressIterations };
+    constexpr TelemetryCounters uniaxialStressTelemetry = { Telemetry::Counter::UniaxialStressCalls,
+                                                            Telemetry::Counter::UniaxialStressIterations };
+
+    enum class Result {
+      Converged,
+      /// the evaluation requested an abort, e.g., due to a cutback of the material
+      Aborted,
+      NotConverged,
+    };
+
+    /// Default settings for plane stress of all material families, see MarmotMaterialMechanical::getPlaneStressOptions
+    extern const Options defaultPlaneStressOptions;
+    /// Default settings for uniaxial stress of all material families
+    extern const Options defaultUniaxialStressOptions;
+
+    /**
+     * Solve for the unknowns \f$\boldsymbol{x}\f$ such that the residual vanishes.
+     *
+     * The callable evaluate( x, residual, dResidual_dX ) computes the residual and its derivative at x, and it returns
+     * false to request an abort. On convergence, the last evaluation corresponds to the returned solution. For a single
+     * unknown, Newton's method is safeguarded by the Illinois variant of the regula falsi as soon as the root is
+     * bracketed.
+     *
+     * @param x[in,out] initial guess and solution
+     * @param evaluate the residual function
+     * @param options tolerances and iteration limits
+     * @param telemetry the counters of the calls and the material evaluations
+     * @param materialType optional material type for the telemetry; a non converged iteration is recorded as cutback
+     */
+    template < int nUnknowns, typename Evaluate >
+    Result solve( Eigen::Matrix< double, nUnknowns, 1 >& x,
+                  Evaluate&&                             evaluate,
+                  const Options&                         options,
+                  const TelemetryCounters&               telemetry,
+                  const char*                            materialType = nullptr );
+
+    /**
+     * Condensation of a strain driven material with respect to the constrained Voigt components.
+     *
+     * The unknowns are the strain increment components (Voigt notation) at the constrained indices, such that the
+     * stress components at the constrained indices attain the target values.
+     *
+     * The callable computeStress( dStrain, stress, dStress_dStrain ) evaluates the material for the given strain
+     * increment, and it returns false to request an abort.
+     *
+     * @param dStrain[in,out] strain increment, the constrained components are used as initial guess
+     * @param stress[out] stress of the last evaluation
+     * @param dStress_dStrain[out] tangent of the last evaluation
+     * @param target target values of the constrained stress components, which vanish for plane and uniaxial stress
+     */
+    template < int... constrainedComponents >
+    struct VoigtConstraint {
+      static constexpr int nConstrained = sizeof...( constrainedComponents );
+
+      template < typename ComputeStress >
+      static Result solve( Vector6d&                                     dStrain,
+                           Vector6d&                                     stress,
+                           Matrix6d&                                     dStress_dStrain,
+                           const Eigen::Matrix< double, nConstrained, 1 >& target,
+                           ComputeStress&&                               computeStress,
+                           const Options&                                options,
+                           const TelemetryCounters&                      telemetry,
+                           const char*                                   materialType = nullptr );
+    };
+
+    /// Plane stress: \f$\sigma_{33} = 0\f$
+    typedef VoigtConstraint< 2 > PlaneStressConstraint;
+    /// Uniaxial stress: \f$\sigma_{22} = \sigma_{33} = 0\f$
+    typedef VoigtConstraint< 1, 2 > UniaxialStressConstraint;
+
+    template < int nUnknowns, typename Evaluate >
+    Result solve( Eigen::Matrix< double, nUnknowns, 1 >& x,
+                  Evaluate&&                             evaluate,
+                  const Options&                         options,
+                  const TelemetryCounters&               telemetry,
+                  const char*                            materialType )
+    {
+      typedef Eigen::Matrix< double, nUnknowns, 1 >         Vector;
+      typedef Eigen::Matrix< double, nUnknowns, nUnknowns > Matrix;
+
+      Vector residual;
+      Matrix dResidual_dX;
+
+      Vector xAccepted        = x;
+      Vector step             = Vector::Zero();
+      double residualAccepted = std::numeric_limits< double >::infinity();
+      int    lineSearchSteps  = 0;
+
+      // bracket of the root for a single unknown, see below
+      double xNegative = 0, residualNegative = 0, xPositive = 0, residualPositive = 0;
+      bool   hasNegative = false, hasPositive = false;
+      int    lastSide    = 0;
+      // the Illinois modification applies to consecutive false position steps only, not to Newton steps
+      bool lastStepWasRegulaFalsi = false;
+
+      auto finish = [&]( int nEvaluations, Result result ) {
+        Telemetry::record( materialType, telemetry.calls );
+        Telemetry::record( materialType, telemetry.evaluations, nEvaluations );
+        if ( result == Result::NotConverged )
+          Telemetry::record( materialType, Telemetry::Counter::Cutbacks );
+        return result;
+      };
+
+      for ( int iteration = 1;; iteration++ ) {
+
+        if ( !evaluate( x, residual, dResidual_dX ) )
+          return finish( iteration, Result::Aborted );
+
+        const double residualNorm = residual.cwiseAbs().sum();
+
+        if ( residualNorm < options.residualTolerance ||
+             ( iteration > options.iterationsBeforeRelaxedTolerance &&
+               residualNorm < options.relaxedResidualTolerance ) )
+          return finish( iteration, Result::Converged );
+
+        if ( iteration >= options.maxIterations )
+          return finish( iteration, Result::NotConverged );
+
+        if constexpr ( nUnknowns == 1 ) {
+          // Illinois bookkeeping: if a false position step updates the same side twice in a row, the residual of the
+          // stale side is halved
+          if ( residual( 0 ) < 0 ) {
+            if ( lastStepWasRegulaFalsi && lastSide < 0 )
+              residualPositive *= 0.5;
+            xNegative        = x( 0 );
+            residualNegative = residual( 0 );
+            hasNegative      = true;
+            lastSide         = -1;
+          }
+          else {
+            if ( lastStepWasRegulaFalsi && lastSide > 0 )
+              residualNegative *= 0.5;
+            xPositive        = x( 0 );
+            residualPositive = residual( 0 );
+            hasPositive      = true;
+            lastSide         = 1;
+          }
+        }
+
+        if ( options.lineSearch && residualNorm > residualAccepted && lineSearchSteps < options.maxLineSearchSteps ) {
+          step *= 0.5;
+          x = xAccepted + step;
+          lineSearchSteps += 1;
+          lastStepWasRegulaFalsi = false;
+          continue;
+        }
+
+        lineSearchSteps  = 0;
+        xAccepted        = x;
+        residualAccepted = residualNorm;
+
+        if constexpr ( nUnknowns == 1 ) {
+          double compliance = 1. / dResidual_dX( 0, 0 );
+          if ( Math::isNaN( compliance ) || std::abs( compliance ) > 1e10 )
+            compliance = 1e10;
+
+          const double xNewton = x( 0 ) - compliance * residual( 0 );
+
+          lastStepWasRegulaFalsi = hasNegative && hasPositive && !( xNewton > std::min( xNegative, xPositive ) &&
+                                                                    xNewton < std::max( xNegative, xPositive ) );
+          if ( lastStepWasRegulaFalsi )
+            // Newton leaves the bracket, fall back to the Illinois variant of the regula falsi
+            step( 0 ) = ( xNegative * residualPositive - xPositive * residualNegative ) /
+                          ( residualPositive - residualNegative ) -
+                        x( 0 );
+          else
+            step( 0 ) = xNewton - x( 0 );
+        }
+        else
+          step = -dResidual_dX.colPivHouseholderQr().solve( residual );
+
+        x += step;
+      }
+    }
+
+    template < int... constrainedComponents >
+    template < typename ComputeStress >
+    Result VoigtConstraint< constrainedComponents... >::solve( Vector6d&                                       dStrain,
+                                                               Vector6d&                                       stress,
+                                                               Matrix6d&                                       dStress_dStrain,
+                                                               const Eigen::Matrix< double, nConstrained, 1 >& target,
+                                                               ComputeStress&&          computeStress,
+                                                               const Options&           options,
+                                                               const TelemetryCounters& telemetry,
+                                                               const char*              materialType )
+    {
+      constexpr int indices[nConstrained] = { constrainedComponents... };
+
+      Eigen::Matrix< double, nConstrained, 1 > x;
+      for ( int i = 0; i < nConstrained; i++ )
+        x( i ) = dStrain( indices[i] );
+
+      auto evaluate = [&]( const Eigen::Matrix< double, nConstrained, 1 >&            x_,
+                           Eigen::Matrix< double, nConstrained, 1 >&                  residual,
+                           Eigen::Matrix< double, nConstrained, nConstrained >&       dResidual_dX ) {
+        for ( int i = 0; i < nConstrained; i++ )
+          dStrain( indices[i] ) = x_( i );
+
+        if ( !computeStress( dStrain, stress, dStress_dStrain ) )
+          return false;
+
+        for ( int i = 0; i < nConstrained; i++ ) {
+          residual( i ) = stress( indices[i] ) - target( i );
+          for ( int j = 0; j < nConstrained; j++ )
+            dResidual_dX( i, j ) = dStress_dStrain( indices[i], indices[j] );
+        }
+        return true;
+      };
+
+      return Condensation::solve< nConstrained >( x, evaluate, options, telemetry, materialType );
+    }
+
+  } // namespace Condensation
 } // namespace Marmot::ContinuumMechanics
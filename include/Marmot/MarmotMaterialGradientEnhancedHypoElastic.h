@@ -29,6 +29,10 @@
 #pragma once
 #include "Marmot/MarmotMaterialGradientEnhancedMechanical.h"
 
+namespace Marmot::ContinuumMechanics::Condensation {
+  struct Options;
+}
+
 /**
  *
  * Derived abstract base class for gradient-enhanced hypo-elastic materials expressed purely in rate form.
@@ -154,4 +158,7 @@ public:
                                    const double* timeOld,
                                    const double  dT,
                                    double&       pNewDT );
+
+  /// Settings of the plane stress condensation; the defaults may be overridden per material
+  virtual const Marmot::ContinuumMechanics::Condensation::Options& getPlaneStressOptions();
 };
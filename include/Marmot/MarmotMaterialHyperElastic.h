@@ -99,6 +99,31 @@ public:
                                  const double  dT,
                                  double&       pNewDT ) = 0;
 
+  /**
+   * Push forward of the 2nd Piola-Kirchhoff stress and its tangent to the Cauchy stress
+   * \f$\boldsymbol{\sigma} = \frac{1}{J}\,\boldsymbol{F}\cdot\boldsymbol{S}\cdot\boldsymbol{F}^T\f$ and the tangent
+   * \f$\frac{\partial\boldsymbol{\sigma}}{\partial\boldsymbol{F}}\f$ (6x3x3, column major).
+   *
+   * The material part is computed as \f$\frac{1}{J}\,\mathbb{P}(\boldsymbol{F}) \cdot
+   * \frac{\partial\boldsymbol{S}}{\partial\boldsymbol{E}} \cdot \frac{\partial\boldsymbol{E}}{\partial\boldsymbol{F}}\f$
+   * with the 6x6 push forward operator \f$\mathbb{P}\f$ and the sparse 6x9 matrix
+   * \f$\frac{\partial\boldsymbol{E}}{\partial\boldsymbol{F}}\f$; the geometric part is added explicitly.
+   *
+   * @param[out]	Cauchy	Cauchy stress
+   * @param[out]	dCauchy_dF	derivative of the Cauchy stress with respect to the deformation gradient
+   * @param[in]	S	2nd Piola-Kirchhoff stress
+   * @param[in]	dSdE	derivative of the 2nd Piola-Kirchhoff stress with respect to the Green-Lagrange strain
+   * @param[in]	F	deformation gradient
+   */
+  static void pushForwardPK2( double* Cauchy, double* dCauchy_dF, const double* S, const double* dSdE, const double* F );
+
+  /// Reference implementation of @ref pushForwardPK2 based on the full tensor contractions
+  static void pushForwardPK2Reference( double*       Cauchy,
+                                       double*       dCauchy_dF,
+                                       const double* S,
+                                       const double* dSdE,
+                                       const double* F );
+
   /**
    * Plane stress implementation of @ref computeStressPK2.
    */
@@ -27,6 +27,7 @@
 
 #pragma once
 #include "Marmot/MarmotMaterialMechanical.h"
+#include "Marmot/MarmotUtils.h"
 
 /**
  *
@@ -110,8 +111,57 @@ public:
                               const double  dT,
                               double&       pNewDT ) = 0;
 
+  /**
+   * Batched version of @ref computeStress for a set of quadrature points sharing the same material parameters.
+   *
+   * All arrays are given in structure-of-arrays layout, i.e., the component \f$c\f$ of point \f$p\f$ is stored at
+   * index \f$c\,n_{\rm Points} + p\f$. The state vars of point \f$p\f$ are stored accordingly at \f$i\,n_{\rm Points}
+   * + p\f$ for \f$i = 0 \dots n_{\rm StateVars}-1\f$, and the tangent entry \f$(i,j)\f$ (column major) at \f$(6j + i)
+   * \, n_{\rm Points} + p\f$.
+   *
+   * The default implementation loops over the per-point @ref computeStress, and it returns as soon as a point
+   * requests a cutback. The state vars of each point are copied to a contiguous buffer, which is assigned by
+   * assignStateVars before the point is computed; the original assignment is restored on return (also if an exception
+   * is thrown). Materials may override it to amortize the setup of parameters and to vectorize across the points.
+   *
+   * @param[in]	nPoints	number of quadrature points in the batch
+   * @param[in,out]	stress	Cauchy stresses (6 x nPoints)
+   * @param[in,out]	dStressDDStrain	Algorithmic tangents (36 x nPoints)
+   * @param[in]	dStrain	linearized strain increments (6 x nPoints)
+   * @param[in,out]	stateVars	state vars (nStateVars x nPoints)
+   * @param[in]	timeOld	Old (pseudo-)time
+   * @param[in]	dt	(Pseudo-)time increment from the old (pseudo-)time to the current (pseudo-)time
+   * @param[in,out]	pNewDT	Suggestion for a new time increment, the minimum over all points
+   */
+  virtual void computeStressBatch( const int     nPoints,
+                                   double*       stress,
+                                   double*       dStressDDStrain,
+                                   const double* dStrain,
+                                   double*       stateVars,
+                                   const double* timeOld,
+                                   const double  dT,
+                                   double&       pNewDT );
+
+  /**
+   * Get the range of state vars which is modified by @ref computeStress. The plane stress and uniaxial stress
+   * wrappers back up and restore only this range in their iterations. The default implementation returns all state
+   * vars; materials with large, purely informative sections may override it and return a contiguous subrange.
+   */
+  virtual StateView getMutableStateVars();
+
+  /**
+   * Get a pointer to the state var which stores the converged ratio
+   * \f$\Delta\varepsilon_{33} / (\Delta\varepsilon_{11} + \Delta\varepsilon_{22})\f$ of the plane stress iteration.
+   * It is used as initial guess in the next increment. The default implementation returns a nullptr, and the
+   * assumption of isochoric deformation is used instead.
+   */
+  virtual double* getPlaneStressStrainRatio();
+
   /**
    * Plane stress implementation of @ref computeStress.
+   *
+   * The out-of-plane strain is found by the condensation engine in @ref Marmot::ContinuumMechanics::Condensation, with
+   * the settings of @ref getPlaneStressOptions; the iterations are counted in the @ref Marmot::Telemetry.
    */
   using MarmotMaterialMechanical::computePlaneStress;
   virtual void computePlaneStress( double*       stress2D,
@@ -27,7 +27,14 @@
 
 #pragma once
 #include "Marmot/MarmotMaterialHypoElastic.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotTypedefs.h"
 #include "autodiff/forward/dual.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <typeinfo>
+#include <unsupported/Eigen/AutoDiff>
 
 class MarmotMaterialHypoElasticAD : public MarmotMaterialHypoElastic {
 
@@ -47,3 +54,171 @@ public:
                               const double  dT,
                               double&       pNewDT ) override;
 };
+
+/**
+ * Base for AD materials whose constitutive law is written once as a template over the scalar type:
+ *
+ *   template < typename T >
+ *   void computeStressADGeneric( T* stress, const T* dStrain, const double* timeOld, const double dT, double& pNewDT );
+ *
+ * It provides @ref MarmotMaterialHypoElasticAD::computeStressAD for autodiff::dual, and @ref computeStress seeds all
+ * six strain directions at once with the multi-directional dual6d, such that the stress and the full tangent result
+ * from a single material evaluation without heap allocations.
+ */
+template < typename Material >
+class MarmotMaterialHypoElasticADGeneric : public MarmotMaterialHypoElasticAD {
+
+public:
+  using MarmotMaterialHypoElasticAD::MarmotMaterialHypoElasticAD;
+
+  /// Multi-directional forward dual number, carrying the derivatives with respect to all six strain components
+  typedef Eigen::AutoDiffScalar< Marmot::Vector6d > dual6d;
+
+  void computeStressAD( autodiff::dual*       stress,
+                        const autodiff::dual* dStrain,
+                        const double*         timeOld,
+                        const double          dT,
+                        double&               pNewDT ) override
+  {
+    static_cast< Material* >( this )->computeStressADGeneric( stress, dStrain, timeOld, dT, pNewDT );
+  }
+
+  void computeStress( double*       stress,
+                      double*       dStressDDStrain,
+                      const double* dStrain,
+                      const double* timeOld,
+                      const double  dT,
+                      double&       pNewDT ) override
+  {
+    Marmot::mVector6d S( stress );
+    Marmot::mMatrix6d C( dStressDDStrain );
+
+    dual6d s[6], dE[6];
+    for ( int i = 0; i < 6; i++ ) {
+      s[i]  = dual6d( S( i ), Marmot::Vector6d::Zero() );
+      dE[i] = dual6d( dStrain[i], 6, i );
+    }
+
+    static_cast< Material* >( this )->computeStressADGeneric( s, dE, timeOld, dT, pNewDT );
+
+    for ( int i = 0; i < 6; i++ ) {
+      S( i )     = s[i].value();
+      C.row( i ) = s[i].derivatives().transpose();
+    }
+  }
+};
+
+/// Selects how a material derived from @ref MarmotMaterialHypoElasticADSelectable computes its tangent
+enum class TangentMode {
+  AutomaticDifferentiation,
+  Analytic,
+};
+
+/**
+ * Mixin for materials providing both an analytic tangent (@ref computeStressAnalytic) and an AD implementation
+ * (@ref MarmotMaterialHypoElasticAD::computeStressAD), selected at compile time. The material passes itself as first
+ * template argument, such that each material has its own verification settings and counters.
+ *
+ * In TangentMode::Analytic, the analytic implementation is used, and on every tangentVerification.samplingInterval-th
+ * call of a thread it is verified against the AD tangent. Mismatches exceeding the relative tolerance are counted and
+ * reported to the rate limited journal.
+ */
+template < typename Material, TangentMode tangentMode >
+class MarmotMaterialHypoElasticADSelectable : public MarmotMaterialHypoElasticAD {
+
+public:
+  using MarmotMaterialHypoElasticAD::MarmotMaterialHypoElasticAD;
+
+  /// Settings and counters of the runtime verification of the analytic tangent
+  struct TangentVerification {
+    /// verify every n-th call of each thread, 0 disables the verification
+    int    samplingInterval  = 1000;
+    double relativeTolerance = 1e-6;
+
+    /// counters of the sampled calls only, hence the atomics are not touched by the unverified calls
+    std::atomic< long > nChecks{ 0 };
+    std::atomic< long > nMismatches{ 0 };
+  };
+
+  inline static TangentVerification tangentVerification;
+
+  /// Analytic implementation of @ref computeStress
+  virtual void computeStressAnalytic( double*       stress,
+                                      double*       dStressDDStrain,
+                                      const double* dStrain,
+                                      const double* timeOld,
+                                      const double  dT,
+                                      double&       pNewDT ) = 0;
+
+  void computeStress( double*       stress,
+                      double*       dStressDDStrain,
+                      const double* dStrain,
+                      const double* timeOld,
+                      const double  dT,
+                      double&       pNewDT ) override;
+};
+
+template < typename Material, TangentMode tangentMode >
+void MarmotMaterialHypoElasticADSelectable< Material, tangentMode >::computeStress( double*       stress,
+                                                                                    double*       dStressDDStrain,
+                                                                                    const double* dStrain,
+                                                                                    const double* timeOld,
+                                                                                    const double  dT,
+                                                                                    double&       pNewDT )
+{
+  using namespace Marmot;
+
+  if constexpr ( tangentMode == TangentMode::AutomaticDifferentiation ) {
+    MarmotMaterialHypoElasticAD::computeStress( stress, dStressDDStrain, dStrain, timeOld, dT, pNewDT );
+  }
+  else {
+    const int interval = tangentVerification.samplingInterval;
+    if ( interval <= 0 ) {
+      computeStressAnalytic( stress, dStressDDStrain, dStrain, timeOld, dT, pNewDT );
+      return;
+    }
+
+    thread_local long nCalls = 0;
+    if ( nCalls++ % interval != 0 ) {
+      computeStressAnalytic( stress, dStressDDStrain, dStrain, timeOld, dT, pNewDT );
+      return;
+    }
+
+    const StateView               mutableStateVars = getMutableStateVars();
+    Eigen::Map< Eigen::VectorXd > stateVars( mutableStateVars.stateLocation, mutableStateVars.stateSize );
+    const Eigen::VectorXd         stateVarsOld = stateVars;
+
+    Vector6d stressAD = Eigen::Map< const Vector6d >( stress );
+    Matrix6d dStressDDStrainAD;
+    double   pNewDTAD = pNewDT;
+
+    MarmotMaterialHypoElasticAD::computeStress( stressAD.data(),
+                                                dStressDDStrainAD.data(),
+                                                dStrain,
+                                                timeOld,
+                                                dT,
+                                                pNewDTAD );
+
+    stateVars = stateVarsOld;
+
+    computeStressAnalytic( stress, dStressDDStrain, dStrain, timeOld, dT, pNewDT );
+
+    if ( pNewDT < 1.0 || pNewDTAD < 1.0 )
+      return;
+
+    tangentVerification.nChecks.fetch_add( 1, std::memory_order_relaxed );
+
+    const Matrix6d deviation     = Eigen::Map< const Matrix6d >( dStressDDStrain ) - dStressDDStrainAD;
+    const double   scale         = std::max( dStressDDStrainAD.cwiseAbs().maxCoeff(), 1e-16 );
+    const double   relativeError = deviation.cwiseAbs().maxCoeff() / scale;
+
+    if ( relativeError > tangentVerification.relativeTolerance ) {
+      tangentVerification.nMismatches.fetch_add( 1, std::memory_order_relaxed );
+
+      static const std::string message = std::string( "analytic tangent of " ) + typeid( *this ).name() +
+                                         " deviates from AD tangent";
+      static Marmot::Journal::RateLimitedMessage tangentMismatch( message.c_str(), Marmot::Journal::Severity::Warning );
+      tangentMismatch.report();
+    }
+  }
+}
@@ -28,6 +28,10 @@
 #pragma once
 #include "Marmot/MarmotMaterial.h"
 
+namespace Marmot::ContinuumMechanics::Condensation {
+  struct Options;
+}
+
 /**
  *  Abstract basic class for Mechanical materials.
  *  'Mechanical' is meant in the 'most general sense', i.e., any material which describes a mechanical (cauchy)
@@ -78,4 +82,10 @@ public:
                                       const double* timeOld,
                                       const double  dT,
                                       double&       pNewDT );
+
+  /// Settings of the plane stress condensation; the defaults may be overridden per material
+  virtual const Marmot::ContinuumMechanics::Condensation::Options& getPlaneStressOptions();
+
+  /// Settings of the uniaxial stress condensation; the defaults may be overridden per material
+  virtual const Marmot::ContinuumMechanics::Condensation::Options& getUniaxialStressOptions();
 };
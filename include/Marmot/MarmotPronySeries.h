@@ -41,6 +41,32 @@ namespace Marmot::Materials {
       Matrix< double, 6, -1 > pronyRelaxationTimes;
     };
 
+    /**
+     * Prony series with a single (scalar) relaxation time per term. Compared to the general @ref Properties, only one
+     * exponential is evaluated per term, and the state of each term is its stress, i.e., the state variables are a
+     * 6 x nPronyTerms matrix.
+     */
+    struct ScalarRelaxationTimeProperties {
+      size_t                  nPronyTerms;
+      Matrix6d                ultimateStiffnessMatrix;
+      Matrix< double, 6, -1 > pronyStiffnesses;
+      VectorXd                pronyRelaxationTimes;
+    };
+
+    /**
+     * Prony series with isotropic terms, each defined by a bulk modulus, a shear modulus and a single relaxation time.
+     * Different relaxation times of the volumetric and the deviatoric part are obtained by separate terms with vanishing
+     * shear and bulk modulus, respectively. As for @ref ScalarRelaxationTimeProperties, the state variables are a
+     * 6 x nPronyTerms matrix.
+     */
+    struct IsotropicProperties {
+      size_t   nPronyTerms;
+      Matrix6d ultimateStiffnessMatrix;
+      VectorXd pronyBulkModuli;
+      VectorXd pronyShearModuli;
+      VectorXd pronyRelaxationTimes;
+    };
+
     typedef Eigen::Matrix< double, 6, Eigen::Dynamic > StateVarMatrix;
     typedef Eigen::Map< StateVarMatrix >               mapStateVarMatrix;
 
@@ -57,5 +83,56 @@ namespace Marmot::Materials {
                           const Vector6d&                 dStrain,
                           const double                    dT );
 
+    /**
+     * Plan of a Prony series increment for a given time increment and state, which contains all quantities independent
+     * of the strain increment. It allows to evaluate the stress and the tangent for several trial strain increments
+     * (e.g., within a Newton iteration) and to commit the converged one to the state variables, without recomputing any
+     * exponentials. The plan is valid as long as the state variables are unchanged, i.e., until it is committed.
+     */
+    struct IncrementPlan {
+      Matrix6d                stiffness;
+      Vector6d                historyStress;
+      Matrix< double, 6, -1 > decay;
+      Matrix< double, 6, -1 > strainFactors;
+    };
+
+    IncrementPlan planIncrement( const Properties&                        props,
+                                 const Eigen::Ref< const StateVarMatrix >& stateVars,
+                                 const double                              dT );
+
+    /// Evaluate the stress and the tangent for a trial strain increment, equivalently to the general kernel
+    void evaluatePronySeries( const IncrementPlan& plan, Vector6d& stress, Matrix6d& stiffness, const Vector6d& dStrain );
+
+    /// Update the state variables with the (converged) strain increment
+    void commitIncrement( const IncrementPlan&            plan,
+                          Eigen::Ref< mapStateVarMatrix > stateVars,
+                          const Vector6d&                 dStrain );
+
+    void evaluatePronySeries( const ScalarRelaxationTimeProperties& props,
+                              Vector6d&                             stress,
+                              Matrix6d&                             stiffness,
+                              Eigen::Ref< mapStateVarMatrix >       stateVars,
+                              const Vector6d&                       dStrain,
+                              const double                          dT,
+                              const bool                            updateStateVars = false );
+
+    void updateStateVars( const ScalarRelaxationTimeProperties& props,
+                          Eigen::Ref< mapStateVarMatrix >       stateVars,
+                          const Vector6d&                       dStrain,
+                          const double                          dT );
+
+    void evaluatePronySeries( const IsotropicProperties&      props,
+                              Vector6d&                       stress,
+                              Matrix6d&                       stiffness,
+                              Eigen::Ref< mapStateVarMatrix > stateVars,
+                              const Vector6d&                 dStrain,
+                              const double                    dT,
+                              const bool                      updateStateVars = false );
+
+    void updateStateVars( const IsotropicProperties&      props,
+                          Eigen::Ref< mapStateVarMatrix > stateVars,
+                          const Vector6d&                 dStrain,
+                          const double                    dT );
+
   } // namespace PronySeries
 } // namespace Marmot::Materials
@@ -0,0 +1,94 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Rate limited frontend of the MarmotJournal for messages, which are potentially emitted at every quadrature point
+ * (e.g., substepper cutbacks).
+ *
+ * Each call site owns a @ref RateLimitedMessage (usually a function local static). Only the first occurrence per call
+ * site and increment is passed to the MarmotJournal; further occurrences are counted in a small per thread table
+ * without any locks or string formatting. At the end of an increment, each thread calls @ref
+ * flushThreadLocalMessages (which is also done at thread exit), and a single thread calls @ref printMessageSummary,
+ * which reports the number of suppressed occurrences per message and rearms the call sites.
+ *
+ * Since the call sites are only rearmed by @ref printMessageSummary, the rate limiting is disabled by default, and
+ * every occurrence is passed to the MarmotJournal. Hosts which call @ref printMessageSummary at the end of each
+ * increment enable it by @ref setRateLimiting.
+ */
+namespace Marmot::Journal {
+
+  enum class Severity { Notification, Warning };
+
+  class RateLimitedMessage {
+
+  public:
+    RateLimitedMessage( const char* message, Severity severity );
+
+    /**
+     * Report an occurrence of the message.
+     *
+     * @return the return value of the respective MarmotJournal function, i.e., true for notifications and false for
+     * warnings
+     */
+    bool report();
+
+    /// Add suppressed occurrences, which have been counted elsewhere
+    void addSuppressed( std::uint64_t n );
+
+    const char* const message;
+    const Severity    severity;
+
+  private:
+    std::atomic< bool >          printedInIncrement;
+    std::atomic< std::uint64_t > nSuppressed;
+    std::atomic< bool >          registered;
+    RateLimitedMessage*          next;
+
+    /// Push the call site onto the global lock free list of call sites (once)
+    void registerCallSite();
+
+    friend void printMessageSummary();
+  };
+
+  /// Enable or disable the rate limiting (disabled by default); if disabled, every occurrence is passed to the
+  /// MarmotJournal
+  void setRateLimiting( bool enable );
+
+  /// Move the occurrences counted by the calling thread to the call sites
+  void flushThreadLocalMessages();
+
+  /**
+   * Print the number of suppressed occurrences per message since the last summary, and rearm all call sites. Should
+   * be called by a single thread at the end of an increment, after all threads have flushed their messages.
+   */
+  void printMessageSummary();
+
+} // namespace Marmot::Journal
@@ -0,0 +1,110 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+/**
+ * Low overhead counters of the numerical algorithms (substeppers, lower dimensional stress wrappers), aggregated per
+ * material type.
+ *
+ * Counters are accumulated in thread local storage without any synchronization, and they are merged into the global
+ * registry by @ref mergeThreadLocalCounters, which should be called by each thread at the end of an increment (and
+ * which is called automatically at thread exit). Recording is disabled by default; if disabled, the costs are a
+ * single relaxed atomic load.
+ *
+ * The material type is identified by a string with static storage duration, e.g., a literal or typeid( *this ).name().
+ */
+namespace Marmot::Telemetry {
+
+  enum class Counter {
+    /// subincrements taken by a substepper, including the rejected ones
+    Substeps,
+    /// subincrements rejected by a substepper (error estimation or non converged return mapping)
+    RejectedSubsteps,
+    /// the minimum subincrement size of a substepper was reached
+    MinimumStepSizeHits,
+    /// calls of the plane stress wrappers
+    PlaneStressCalls,
+    /// material evaluations in the plane stress wrappers
+    PlaneStressIterations,
+    /// calls of the uniaxial stress wrappers
+    UniaxialStressCalls,
+    /// material evaluations in the uniaxial stress wrappers
+    UniaxialStressIterations,
+    /// cutbacks requested by a wrapper due to non convergence
+    Cutbacks,
+    nCounters,
+  };
+
+  constexpr int nCounters = static_cast< int >( Counter::nCounters );
+
+  typedef std::array< std::uint64_t, nCounters > Counters;
+
+  /// Names of the counters, as used in the CSV header and as JSON keys
+  extern const std::array< const char*, nCounters > counterNames;
+
+  extern std::atomic< bool > enabled;
+
+  void enable( bool enable = true );
+
+  inline bool isEnabled()
+  {
+    return enabled.load( std::memory_order_relaxed );
+  }
+
+  /// Add to a counter of a material type in the thread local accumulator of the calling thread
+  void recordThreadLocal( const char* materialType, Counter counter, std::uint64_t n );
+
+  /// Add to a counter of a material type; no-op if telemetry is disabled or no material type is given
+  inline void record( const char* materialType, Counter counter, std::uint64_t n = 1 )
+  {
+    if ( materialType && isEnabled() )
+      recordThreadLocal( materialType, counter, n );
+  }
+
+  /// Merge the thread local accumulator of the calling thread into the global registry, and reset it
+  void mergeThreadLocalCounters();
+
+  /// Get a copy of the global registry, i.e., all counters merged so far
+  std::map< std::string, Counters > getMergedCounters();
+
+  /// Reset the global registry
+  void reset();
+
+  /// Write the global registry as CSV, one line per material type
+  void writeCSV( std::ostream& out );
+
+  /// Write the global registry as JSON object, one member per material type
+  void writeJSON( std::ostream& out );
+
+} // namespace Marmot::Telemetry
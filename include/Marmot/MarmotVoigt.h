@@ -305,12 +305,44 @@ namespace Marmot {
 
     namespace Invariants {
 
+      /**
+       * Computes the eigenvalues of a symmetric 3x3 tensor given in Voigt notation with the off diagonal components
+       * without factor (i.e., stress like), in ascending order.
+       *
+       * The eigenvalues are computed in closed form by the trigonometric solution of the characteristic polynomial of
+       * the deviator. The two eigenvalues of a close pair (distance below \f$10^{-1}\f$ of the deviatoric scale
+       * \f$\sqrt{J_2/3}\f$) are ill conditioned in this solution, and are refined as described in @ref
+       * symmetricEigenDecomposition.
+       *
+       * Accuracy: the absolute error of all eigenvalues is a small multiple of \f$\epsilon\, \|\boldsymbol{\sigma}\|\f$,
+       * as for Eigen's iterative SelfAdjointEigenSolver.
+       */
+      Eigen::Vector3d symmetricEigenvalues( const Marmot::Vector6d& voigtStress );
+
+      /**
+       * Computes the eigenvalues (ascending) and the respective eigenvectors (columns) of a symmetric 3x3 tensor given in
+       * Voigt notation with the off diagonal components without factor.
+       *
+       * The eigenvalues are computed as in @ref symmetricEigenvalues. The eigenvector of the isolated eigenvalue (the one
+       * with the largest distance to the others) is computed as the largest cross product of two columns of
+       * \f$\boldsymbol{\sigma} - \lambda\, \boldsymbol{I}\f$. The tensor projected onto the complementary plane is
+       * diagonalized by a single Jacobi rotation, which is exact for the remaining 2x2 block and hence robust for
+       * (nearly) repeated eigenvalues.
+       *
+       * Accuracy: the eigenvalues have an absolute error of a small multiple of \f$\epsilon\, \|\boldsymbol{\sigma}\|\f$,
+       * the eigenvectors are orthonormal up to a small multiple of \f$\epsilon\f$, and their angular error is of the
+       * order \f$\epsilon\, \|\boldsymbol{\sigma}\| / \delta\f$ with the distance \f$\delta\f$ to the closest other
+       * eigenvalue (the conditioning of the problem itself). For repeated eigenvalues, an arbitrary orthonormal basis of
+       * the eigenspace is returned.
+       */
+      std::pair< Eigen::Vector3d, Eigen::Matrix3d > symmetricEigenDecomposition( const Marmot::Vector6d& voigtStress );
+
       /** Computes the principal strains by solving the eigenvalue problem.
        *\f[
            \displaystyle |\varepsilon_{ij} - \lambda\, \delta_{ij}| = 0 \hspace{.5cm} \Rightarrow \hspace{.5cm}
      \lambda^{(1)},\lambda^{(2)},\lambda^{(3)}\hspace{0.3cm} \widehat{=}\hspace{0.3cm} \varepsilon_1,\, \varepsilon_2,\,
      \varepsilon_3 \f]
-       * The resulting principal strains are NOT sorted.
+       * The resulting principal strains are NOT sorted (currently, they are computed by @ref symmetricEigenvalues).
        */
       Eigen::Vector3d principalStrains( const Marmot::Vector6d& strain );
 
@@ -319,7 +351,7 @@ namespace Marmot {
            \displaystyle |\sigma_{ij} - \lambda\, \delta_{ij}| = 0 \hspace{.5cm} \Rightarrow \hspace{.5cm}
      \lambda^{(1)},\lambda^{(2)},\lambda^{(3)}\hspace{0.3cm} \widehat{=}\hspace{0.3cm}\sigma_1,\, \sigma_2,\, \sigma_3
         \f]
-       * The resulting principal stresses are NOT sorted.
+       * The resulting principal stresses are NOT sorted (currently, they are computed by @ref symmetricEigenvalues).
        */
       Eigen::Vector3d principalStresses( const Marmot::Vector6d& stress );
       // principal strains calculated from haigh westergaard strains ( sorted --> e1 > e2 > e3 )
@@ -340,7 +372,9 @@ namespace Marmot {
                           -\sin\left(\frac{\pi}{6} + \theta\right)
                              \end{bmatrix}
         \f]
-       *The computation of \f$ \xi\f$ ,\ \f$ \rho\f$ and \f$\theta\f$ can be found in haighWestergaardFromStrain()
+       *The computation of \f$ \xi\f$ ,\ \f$ \rho\f$ and \f$\theta\f$ can be found in haighWestergaardFromStrain().
+       * The principal strains are actually computed by @ref symmetricEigenvalues, which is more accurate at the
+       * meridians.
        */
       Eigen::Vector3d sortedPrincipalStrains( const Marmot::Vector6d& strain );
       // principal stressDirections calculated by solving eigenvalue problem ( !NOT sorted! )
@@ -350,7 +384,8 @@ namespace Marmot {
        *\f[
            \displaystyle \left(\boldsymbol{\sigma} - \sigma_k \cdot \boldsymbol{I}\right) \cdot \boldsymbol{x}^{(k)}  =
        0 \f]
-       * The resulting principal stress directions are NOT sorted.
+       * The resulting principal stress directions are NOT sorted (currently, they are computed by @ref
+       * symmetricEigenDecomposition).
        */
       Eigen::Matrix3d principalStressesDirections( const Marmot::Vector6d& stress );
 
@@ -592,9 +627,22 @@ namespace Marmot {
       /**
        * Computes the derivative \f$ \frac{d\, \sigma_I}{d\, \boldsymbol{\sigma}}\f$ of the principal stresses  \f$
        * \sigma_I \f$ with respect to the voigt notated stress vector \f$ \boldsymbol{\sigma} \f$
+       *
+       * The derivatives are computed analytically from the eigenprojections, \f$ \frac{d\, \sigma_I}{d\,
+       * \boldsymbol{\sigma}} = \boldsymbol{n}_I \otimes \boldsymbol{n}_I \f$, in the order of @ref
+       * Invariants::principalStresses. For repeated principal stresses (relative difference below \f$10^{-8}\f$), the
+       * mean eigenprojection of the repeated ones is used.
        */
       Marmot::Matrix36 dStressPrincipals_dStress( const Marmot::Vector6d& stress );
 
+      /**
+       * Computes the derivative \f$ \frac{d\, \varepsilon_I}{d\, \boldsymbol{\varepsilon}}\f$ of the principal
+       * strains \f$ \varepsilon_I \f$ with respect to the voigt notated strain vector \f$ \boldsymbol{\varepsilon}
+       * \f$, in the order of @ref Invariants::principalStrains. Repeated principal strains are treated as in @ref
+       * dStressPrincipals_dStress.
+       */
+      Marmot::Matrix36 dStrainPrincipals_dStrain( const Marmot::Vector6d& strain );
+
       // derivatives of plastic strains with respect to strains
 
       /**
@@ -627,7 +675,9 @@ namespace Marmot {
 
       /**
        * Computes the derivative \f$ \frac{d\, \varepsilon_I}{d\, \boldsymbol{\varepsilon}}\f$ of the principal strains
-       * \f$ \varepsilon_I \f$ with respect to the voigt notated strain vector  \f$ \boldsymbol{\varepsilon} \f$
+       * \f$ \varepsilon_I \f$ with respect to the voigt notated strain vector  \f$ \boldsymbol{\varepsilon} \f$, in the
+       * order of @ref Invariants::sortedPrincipalStrains ( \f$ \varepsilon_1 \geq \varepsilon_2 \geq \varepsilon_3 \f$
+       * ). Repeated principal strains are treated as in @ref dStressPrincipals_dStress.
        */
       Marmot::Matrix36 dSortedStrainPrincipal_dStrain( const Marmot::Vector6d& dEp );
 
@@ -28,6 +28,7 @@
 
 #pragma once
 #include "Marmot/HaighWestergaard.h"
+#include <tuple>
 #include <utility>
 
 namespace Marmot {
@@ -93,7 +94,7 @@ namespace Marmot {
         double e;  /**< Eccentricity parameter \f$e\f$; to obtain a smooth and
                       convex surface $e$ has to be in the range of \f$0.5\leq e
                       \leq 1\f$ */
-      } param;
+      };
 
       // Reduction of the generalized failure criterion to a specific type.
       enum class MenetreyWillamType {
@@ -115,7 +116,7 @@ namespace Marmot {
        * Constructor that takes the uniaxial tensile strength \f$f_t\f$ and two
        * optional arguments consisting of the specific type of failure criterion \ref MenetreyWillamType
        * and the uniaxial compressive strength \f$f_c\f$. The call of the
-       * constructor automatically fills the corresponding Menetrey-Willam \ref param.
+       * constructor automatically fills the corresponding Menetrey-Willam parameters, see @ref getParameters.
        */
       MenetreyWillam( const double              ft,
                       const MenetreyWillamType& type = MenetreyWillamType::Rankine,
@@ -128,9 +129,15 @@ namespace Marmot {
        */
       void setParameters( const double ft, const double fc, const MenetreyWillamType& type );
 
+      /// Set the Menetrey-Willam parameters directly
+      void setParameters( const MenetreyWillamParameters& parameters );
+
+      /// Get the Menetrey-Willam parameters, which are modified by @ref setParameters only
+      const MenetreyWillamParameters& getParameters() const { return param; }
+
       /**
        * Compute the polar radius \f$r\f$ from the Lode angle \f$\theta\f$. The
-       * eccentricity parameter will be used from the chosen Menetrey-Willam parameters \ref param.
+       * eccentricity parameter will be used from the chosen Menetrey-Willam parameters, see @ref getParameters.
        */
       template < typename T >
       T polarRadius( const double& theta ) const
@@ -167,7 +174,7 @@ namespace Marmot {
       /**
        * Compute the polar radius \f$r\f$ and its derivative
        * \f$\frac{dr}{d\theta}\f$ from the Lode angle \f$\theta\f$. The
-       * eccentricity parameter will be used from the @ref param struct.
+       * eccentricity parameter will be used from the Menetrey-Willam parameters, see @ref getParameters.
        */
       template < typename T >
       std::pair< T, T > dPolarRadius_dTheta( const T& theta ) const
@@ -273,15 +280,15 @@ namespace Marmot {
       T yieldFunction( const ContinuumMechanics::HaighWestergaard::HaighWestergaardCoordinates< T >& hw,
                        const double varEps = 0.0 ) const
       {
-        const T r_ = polarRadius( hw.theta, param.e );
+        using std::sqrt;
+        const T r_ = polarRadiusPrecomputed( hw.theta );
         if ( varEps == 0 )
-          return ( param.Af * hw.rho ) * ( param.Af * hw.rho ) +
-                 param.m * ( param.Bf * hw.rho * r_ + param.Cf * hw.xi ) - 1.;
-        else
-          return param.Af * param.Af * hw.rho * hw.rho +
-                 param.m * ( std::sqrt( param.Bf * hw.rho * r_ * param.Bf * hw.rho * r_ + varEps * varEps ) +
-                             param.Cf * hw.xi ) -
-                 1.;
+          return constants.Af2 * hw.rho * hw.rho + constants.mBf * hw.rho * r_ + constants.mCf * hw.xi - 1.;
+        else {
+          const T BfRhoR = param.Bf * hw.rho * r_;
+          return constants.Af2 * hw.rho * hw.rho + param.m * sqrt( BfRhoR * BfRhoR + varEps * varEps ) +
+                 constants.mCf * hw.xi - 1.;
+        }
       }
 
       /**
@@ -296,14 +303,14 @@ namespace Marmot {
         const ContinuumMechanics::HaighWestergaard::HaighWestergaardCoordinates< T >& hw,
         const double                                                                  varEps = 0.0 ) const
       {
-        const auto [r_, dRdTheta_] = dPolarRadius_dTheta( hw.theta, param.e );
+        const auto [r_, dRdTheta_] = dPolarRadius_dThetaPrecomputed( hw.theta );
 
         T dFdXi, dFdRho, dFdTheta;
-        dFdXi = param.m * param.Cf;
+        dFdXi = constants.mCf;
 
         if ( varEps == 0.0 ) {
-          dFdRho   = 2. * param.Af * hw.rho * param.Af + param.m * param.Bf * r_;
-          dFdTheta = param.m * param.Bf * hw.rho * dRdTheta_;
+          dFdRho   = 2. * constants.Af2 * hw.rho + constants.mBf * r_;
+          dFdTheta = constants.mBf * hw.rho * dRdTheta_;
         }
         else {
           const T auxTerm1 = param.m * 0.5 *
@@ -317,6 +324,53 @@ namespace Marmot {
         return { dFdXi, dFdRho, dFdTheta };
       }
 
+      /**
+       * Batched evaluation of the yield function \f$f\f$ for many Haigh-Westergaard coordinates given in
+       * structure-of-arrays layout, using the precomputed @ref constants. The arrays are processed in chunks, such that
+       * no memory is allocated and the arithmetic is vectorized.
+       *
+       * @param[in] xi hydrostatic components \f$\xi\f$
+       * @param[in] rho deviatoric radii \f$\rho\f$
+       * @param[in] theta Lode angles \f$\theta\f$
+       * @param[out] f yield function values
+       * @param[in] varEps optional fillet parameter, see @ref yieldFunction
+       */
+      void yieldFunctionBatch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                               const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                               const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                               Eigen::Ref< Eigen::ArrayXd >              f,
+                               const double                              varEps = 0.0 ) const;
+
+      /**
+       * Batched version of @ref yieldFunction and @ref dYieldFunction_dHaighWestergaard.
+       */
+      void dYieldFunction_dHaighWestergaardBatch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                                                  const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                                                  const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                                                  Eigen::Ref< Eigen::ArrayXd >              f,
+                                                  Eigen::Ref< Eigen::ArrayXd >              dF_dXi,
+                                                  Eigen::Ref< Eigen::ArrayXd >              dF_dRho,
+                                                  Eigen::Ref< Eigen::ArrayXd >              dF_dTheta,
+                                                  const double                              varEps = 0.0 ) const;
+
+      /**
+       * Batched evaluation of the yield function, its first derivatives and its non vanishing second derivatives
+       * \f$\frac{\partial^2 f}{\partial\rho^2},\,\frac{\partial^2 f}{\partial\rho\,\partial\theta},\,
+       * \frac{\partial^2 f}{\partial\theta^2}\f$ with respect to the Haigh-Westergaard coordinates (\f$f\f$ is linear
+       * in \f$\xi\f$).
+       */
+      void d2YieldFunction_dHaighWestergaard2Batch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                                                    const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                                                    const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                                                    Eigen::Ref< Eigen::ArrayXd >              f,
+                                                    Eigen::Ref< Eigen::ArrayXd >              dF_dXi,
+                                                    Eigen::Ref< Eigen::ArrayXd >              dF_dRho,
+                                                    Eigen::Ref< Eigen::ArrayXd >              dF_dTheta,
+                                                    Eigen::Ref< Eigen::ArrayXd >              d2F_dRho2,
+                                                    Eigen::Ref< Eigen::ArrayXd >              d2F_dRho_dTheta,
+                                                    Eigen::Ref< Eigen::ArrayXd >              d2F_dTheta2,
+                                                    const double                              varEps = 0.0 ) const;
+
       /**
        * Compute a fillet parameter for the vertex of the yield surface along the hydrostatic axis in the same way as
        * Abaqus does. This parameter is only relevant in the case of the Drucker-Prager or the Mohr-Coulomb criterion.
@@ -365,6 +419,106 @@ namespace Marmot {
       {
         return 2 * c * std::cos( phi ) / ( 1 - std::sin( phi ) );
       }
+
+    private:
+      MenetreyWillamParameters param;
+
+      /// Constants depending only on the @ref param, for the evaluation of the polar radius and the yield function
+      struct PrecomputedConstants {
+        bool   circular;      /**< \f$e \geq 1\f$, i.e., \f$r \equiv 1\f$ */
+        double oneMinusE2;    /**< \f$1-e^2\f$ */
+        double twoEMinusOne;  /**< \f$2e-1\f$ */
+        double twoEMinusOne2; /**< \f$(2e-1)^2\f$ */
+        double fiveE2Minus4E; /**< \f$5e^2-4e\f$ */
+        double Af2;           /**< \f$A_f^2\f$ */
+        double mBf;           /**< \f$m\,B_f\f$ */
+        double mCf;           /**< \f$m\,C_f\f$ */
+      } constants;
+
+      /// Update the @ref constants after a modification of the @ref param
+      void updatePrecomputedConstants();
+
+      /**
+       * Polar radius \f$r\f$ and optionally its first and second derivative with respect to \f$\theta\f$ for
+       * \f$e<1\f$, based on the precomputed @ref constants. T may be a scalar type or an Eigen array. The sine of the
+       * Lode angle is only required for the derivatives.
+       */
+      template < typename T >
+      void polarRadiusKernel( const T& cosTheta,
+                              const T* sinTheta_,
+                              T&       r,
+                              T*       dR_dTheta   = nullptr,
+                              T*       d2R_dTheta2 = nullptr ) const
+      {
+        using std::sqrt;
+
+        const double a = 4. * constants.oneMinusE2;
+
+        const T cos2Theta = cosTheta * cosTheta;
+        const T aux       = a * cos2Theta + constants.fiveE2Minus4E;
+        const T sqrtAux   = sqrt( aux );
+
+        const T numerator   = a * cos2Theta + constants.twoEMinusOne2;
+        const T denominator = 2. * constants.oneMinusE2 * cosTheta + constants.twoEMinusOne * sqrtAux;
+
+        r = numerator / denominator;
+        if ( !dR_dTheta )
+          return;
+
+        const T& sinTheta           = *sinTheta_;
+        const T dNumerator_dTheta   = -2. * a * cosTheta * sinTheta;
+        const T dSqrtAux_dTheta     = 0.5 * dNumerator_dTheta / sqrtAux;
+        const T dDenominator_dTheta = -2. * constants.oneMinusE2 * sinTheta + constants.twoEMinusOne * dSqrtAux_dTheta;
+        const T dR_dTheta_          = ( dNumerator_dTheta - r * dDenominator_dTheta ) / denominator;
+
+        *dR_dTheta = dR_dTheta_;
+        if ( !d2R_dTheta2 )
+          return;
+
+        const T d2Numerator_dTheta2   = -2. * a * ( cos2Theta - sinTheta * sinTheta );
+        const T d2SqrtAux_dTheta2     = ( 0.5 * d2Numerator_dTheta2 - dSqrtAux_dTheta * dSqrtAux_dTheta ) / sqrtAux;
+        const T d2Denominator_dTheta2 = -2. * constants.oneMinusE2 * cosTheta +
+                                        constants.twoEMinusOne * d2SqrtAux_dTheta2;
+
+        *d2R_dTheta2 = ( d2Numerator_dTheta2 - 2. * dR_dTheta_ * dDenominator_dTheta - r * d2Denominator_dTheta2 ) /
+                       denominator;
+      }
+
+      template < typename T >
+      T polarRadiusPrecomputed( const T& theta ) const
+      {
+        using std::cos;
+        if ( constants.circular )
+          return T( 1 );
+        T r;
+        polarRadiusKernel< T >( cos( theta ), nullptr, r );
+        return r;
+      }
+
+      template < typename T >
+      std::pair< T, T > dPolarRadius_dThetaPrecomputed( const T& theta ) const
+      {
+        using std::cos, std::sin;
+        if ( constants.circular )
+          return { T( 1 ), T( 0 ) };
+        const T cosTheta = cos( theta );
+        const T sinTheta = sin( theta );
+        T       r, dR_dTheta;
+        polarRadiusKernel< T >( cosTheta, &sinTheta, r, &dR_dTheta );
+        return { r, dR_dTheta };
+      }
+
+      void evaluateBatch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                          const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                          const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                          const double                              varEps,
+                          double*                                   f,
+                          double*                                   dF_dXi,
+                          double*                                   dF_dRho,
+                          double*                                   dF_dTheta,
+                          double*                                   d2F_dRho2,
+                          double*                                   d2F_dRho_dTheta,
+                          double*                                   d2F_dTheta2 ) const;
     };
 
   } // namespace ContinuumMechanics::CommonConstitutiveModels
@@ -28,7 +28,10 @@
 #pragma once
 #include "Marmot/MarmotJournal.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotTelemetry.h"
 #include "Marmot/MarmotTypedefs.h"
+#include "Marmot/SubstepSizeMemory.h"
 
 namespace Marmot::NumericalAlgorithms {
 
@@ -65,6 +68,14 @@ namespace Marmot::NumericalAlgorithms {
     /// get the overall consistent algorithmic tangent
     Matrix6d consistentStiffness();
 
+    /// Seed the subincrement size from a state var, and store it there at the end, see @ref SubstepSizeMemory
+    void enableStepSizeMemory( double& lastSuccessfulSubstepSize, double relaxationFactor = 2.0 );
+    /// get the number of calls to decreaseSubstepSize
+    int getNumberOfDecreasedSubsteps();
+
+    /// Record the subincrements in the @ref Marmot::Telemetry counters of the given material type
+    void enableTelemetry( const char* materialType );
+
   private:
     const double initialStepSize, minimumStepSize, scaleUpFactor, scaleDownFactor;
     const int    nPassesToIncrease;
@@ -73,6 +84,14 @@ namespace Marmot::NumericalAlgorithms {
     double currentSubstepSize;
     int    passedSubsteps;
 
+    /// subincrement size before the truncation to the remaining progress
+    double            nominalSubstepSize;
+    SubstepSizeMemory stepSizeMemory;
+    int               nDecreasedSubsteps;
+
+    /// material type for the telemetry counters, nullptr if disabled
+    const char* telemetryMaterialType;
+
     const Matrix6d& Cel;
 
     TangentSizedMatrix consistentTangent;
@@ -97,6 +116,9 @@ namespace Marmot::NumericalAlgorithms {
       currentProgress( 0.0 ),
       currentSubstepSize( initialStepSize ),
       passedSubsteps( 0 ),
+      nominalSubstepSize( initialStepSize ),
+      nDecreasedSubsteps( 0 ),
+      telemetryMaterialType( nullptr ),
       Cel( Cel )
   {
     consistentTangent = TangentSizedMatrix::Zero();
@@ -115,6 +137,9 @@ namespace Marmot::NumericalAlgorithms {
     if ( passedSubsteps >= nPassesToIncrease )
       currentSubstepSize *= scaleUpFactor;
 
+    nominalSubstepSize = currentSubstepSize;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::Substeps );
+
     const double remainingProgress = 1.0 - currentProgress;
     if ( remainingProgress < currentSubstepSize )
       currentSubstepSize = remainingProgress;
@@ -130,19 +155,31 @@ namespace Marmot::NumericalAlgorithms {
   {
     currentProgress -= currentSubstepSize;
     passedSubsteps = 0;
+    nDecreasedSubsteps++;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
 
     currentSubstepSize *= scaleDownFactor;
-
-    if ( currentSubstepSize < minimumStepSize )
-      return MarmotJournal::warningToMSG( "UMAT: Substepper: Minimal stepzsize reached" );
-    else
-      return MarmotJournal::notificationToMSG( "UMAT: Substepper: Decreasing stepsize" );
+    nominalSubstepSize = currentSubstepSize;
+
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
+    else {
+      static Journal::RateLimitedMessage decreasingStepSize( "UMAT: Substepper: Decreasing stepsize",
+                                                             Journal::Severity::Notification );
+      return decreasingStepSize.report();
+    }
   }
 
   template < int n >
   void PerezFougetSubstepper< n >::finishElasticSubstep()
   {
     consistentTangent += currentSubstepSize * TangentSizedMatrix::Identity();
+    if ( isFinished() )
+      stepSizeMemory.store( nominalSubstepSize );
   }
 
   template < int n >
@@ -162,4 +199,26 @@ namespace Marmot::NumericalAlgorithms {
   {
     return consistentTangent.topLeftCorner( 6, 6 ) * Cel;
   }
+
+  template < int n >
+  void PerezFougetSubstepper< n >::enableStepSizeMemory( double& lastSuccessfulSubstepSize, double relaxationFactor )
+  {
+    currentSubstepSize = stepSizeMemory.bind( lastSuccessfulSubstepSize,
+                                              relaxationFactor,
+                                              initialStepSize,
+                                              minimumStepSize );
+    nominalSubstepSize = currentSubstepSize;
+  }
+
+  template < int n >
+  int PerezFougetSubstepper< n >::getNumberOfDecreasedSubsteps()
+  {
+    return nDecreasedSubsteps;
+  }
+
+  template < int n >
+  void PerezFougetSubstepper< n >::enableTelemetry( const char* materialType )
+  {
+    telemetryMaterialType = materialType;
+  }
 } // namespace Marmot::NumericalAlgorithms
@@ -26,7 +26,10 @@
  */
 
 #pragma once
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotTelemetry.h"
 #include "Marmot/MarmotTypedefs.h"
+#include "Marmot/SubstepSizeMemory.h"
 
 namespace Marmot::NumericalAlgorithms {
   /**
@@ -64,6 +67,14 @@ namespace Marmot::NumericalAlgorithms {
     void     extendConsistentTangent( const Matrix6d& CelT, const TangentSizedMatrix& matTangent );
     Matrix6d consistentStiffness();
 
+    /// Seed the subincrement size from a state var, and store it there at the end, see @ref SubstepSizeMemory
+    void enableStepSizeMemory( double& lastSuccessfulSubstepSize, double relaxationFactor = 2.0 );
+    /// get the number of calls to decreaseSubstepSize
+    int getNumberOfDecreasedSubsteps();
+
+    /// Record the subincrements in the @ref Marmot::Telemetry counters of the given material type
+    void enableTelemetry( const char* materialType );
+
   private:
     const double initialStepSize, minimumStepSize, scaleUpFactor, scaleDownFactor;
     const int    nPassesToIncrease;
@@ -72,6 +83,14 @@ namespace Marmot::NumericalAlgorithms {
     double currentSubstepSize;
     int    passedSubsteps;
 
+    /// subincrement size before the truncation to the remaining progress
+    double            nominalSubstepSize;
+    SubstepSizeMemory stepSizeMemory;
+    int               nDecreasedSubsteps;
+
+    /// material type for the telemetry counters, nullptr if disabled
+    const char* telemetryMaterialType;
+
     TangentSizedMatrix elasticTangent;
     TangentSizedMatrix consistentTangent;
   };
@@ -93,7 +112,10 @@ namespace Marmot::NumericalAlgorithms {
       nPassesToIncrease( nPassesToIncrease ),
       currentProgress( 0.0 ),
       currentSubstepSize( initialStepSize ),
-      passedSubsteps( 0 )
+      passedSubsteps( 0 ),
+      nominalSubstepSize( initialStepSize ),
+      nDecreasedSubsteps( 0 ),
+      telemetryMaterialType( nullptr )
 
   {
     elasticTangent    = TangentSizedMatrix::Identity();
@@ -112,6 +134,9 @@ namespace Marmot::NumericalAlgorithms {
     if ( passedSubsteps >= nPassesToIncrease )
       currentSubstepSize *= scaleUpFactor;
 
+    nominalSubstepSize = currentSubstepSize;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::Substeps );
+
     const double remainingProgress = 1.0 - currentProgress;
     if ( remainingProgress < currentSubstepSize )
       currentSubstepSize = remainingProgress;
@@ -133,13 +158,23 @@ namespace Marmot::NumericalAlgorithms {
   {
     currentProgress -= currentSubstepSize;
     passedSubsteps = 0;
+    nDecreasedSubsteps++;
+    Telemetry::record( telemetryMaterialType, Telemetry::Counter::RejectedSubsteps );
 
     currentSubstepSize *= scaleDownFactor;
-
-    if ( currentSubstepSize < minimumStepSize )
-      return MarmotJournal::warningToMSG( "UMAT: Substepper: Minimal stepzsize reached" );
-    else
-      return MarmotJournal::notificationToMSG( "UMAT: Substepper: Decreasing stepsize" );
+    nominalSubstepSize = currentSubstepSize;
+
+    if ( currentSubstepSize < minimumStepSize ) {
+      Telemetry::record( telemetryMaterialType, Telemetry::Counter::MinimumStepSizeHits );
+      static Journal::RateLimitedMessage minimumStepSizeReached( "UMAT: Substepper: Minimal stepzsize reached",
+                                                                 Journal::Severity::Warning );
+      return minimumStepSizeReached.report();
+    }
+    else {
+      static Journal::RateLimitedMessage decreasingStepSize( "UMAT: Substepper: Decreasing stepsize",
+                                                             Journal::Severity::Notification );
+      return decreasingStepSize.report();
+    }
   }
 
   template < int s >
@@ -148,6 +183,8 @@ namespace Marmot::NumericalAlgorithms {
 
     elasticTangent.topLeftCorner( 6, 6 ) = CelT;
     consistentTangent += currentSubstepSize * elasticTangent;
+    if ( isFinished() )
+      stepSizeMemory.store( nominalSubstepSize );
   }
 
   template < int s >
@@ -163,4 +200,27 @@ namespace Marmot::NumericalAlgorithms {
   {
     return consistentTangent.topLeftCorner( 6, 6 );
   }
+
+  template < int s >
+  void PerezFougetSubstepperTime< s >::enableStepSizeMemory( double& lastSuccessfulSubstepSize,
+                                                             double  relaxationFactor )
+  {
+    currentSubstepSize = stepSizeMemory.bind( lastSuccessfulSubstepSize,
+                                              relaxationFactor,
+                                              initialStepSize,
+                                              minimumStepSize );
+    nominalSubstepSize = currentSubstepSize;
+  }
+
+  template < int s >
+  int PerezFougetSubstepperTime< s >::getNumberOfDecreasedSubsteps()
+  {
+    return nDecreasedSubsteps;
+  }
+
+  template < int s >
+  void PerezFougetSubstepperTime< s >::enableTelemetry( const char* materialType )
+  {
+    telemetryMaterialType = materialType;
+  }
 } // namespace Marmot::NumericalAlgorithms
@@ -0,0 +1,70 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+namespace Marmot::NumericalAlgorithms {
+
+  /**
+   * Memory of the subincrement size of a substepper across increments, kept in a state var of the material.
+   *
+   * The seed of the first subincrement is min( initialStepSize, relaxationFactor * lastSuccessfulSubstepSize ), such
+   * that the restriction decays over the increments; non-finite or too small memories are replaced by the
+   * initialStepSize. The substepper stores the nominal size (i.e., before the truncation to the remaining progress)
+   * when the last subincrement of an increment is accepted.
+   */
+  class SubstepSizeMemory {
+
+  public:
+    /// Bind the state var, and return the seed of the first subincrement size
+    double bind( double& lastSuccessfulSubstepSize,
+                 double  relaxationFactor,
+                 double  initialStepSize,
+                 double  minimumStepSize )
+    {
+      memory = &lastSuccessfulSubstepSize;
+
+      if ( std::isfinite( lastSuccessfulSubstepSize ) && lastSuccessfulSubstepSize >= minimumStepSize )
+        return std::min( initialStepSize, relaxationFactor * lastSuccessfulSubstepSize );
+      else
+        return initialStepSize;
+    }
+
+    /// Store the nominal size of the last accepted subincrement, if a state var is bound
+    void store( double nominalSubstepSize )
+    {
+      if ( memory )
+        *memory = nominalSubstepSize;
+    }
+
+  private:
+    double* memory = nullptr;
+  };
+
+} // namespace Marmot::NumericalAlgorithms
@@ -27,32 +27,64 @@
 
 #pragma once
 #include "Marmot/MarmotTypedefs.h"
+#include <bitset>
+#include <cstdint>
+#include <limits>
 
 namespace Marmot {
   namespace NumericalAlgorithms {
     /** Manager for yield surface combinations for multisurface plasticity:
      * Try different yield surface combinations and track already used combinations
+     *
+     * Combinations are represented as bitmasks (bit i set if yield surface i is active), and the used combinations are
+     * tracked in a bitset indexed by the mask.
      * */
     template < int nYieldSurfaces >
     class YieldSurfaceCombinationManager {
-      /// Column in the YieldSurfFlagArr for marking a combination as used
-      const int idxUsedFlag;
+      static_assert( nYieldSurfaces > 0 && nYieldSurfaces < 16, "too many yield surfaces for bitmask combinations" );
 
     public:
-      /// An array which contains every possible (reasonable) combination of yield surfaces
-      Eigen::Array< bool, ( 1 << nYieldSurfaces ) - 1, ( nYieldSurfaces + 1 ) > yieldSurfaceCombinations;
+      /// Number of masks including the empty combination
+      static constexpr std::uint32_t nMasks = 1u << nYieldSurfaces;
+
       /// An array to carry active/nonactive states of yield surfaces
       typedef Eigen::Array< bool, 1, nYieldSurfaces > YieldSurfFlagArr;
       /// An array to carry values of yield functions
       typedef Eigen::Array< double, 1, nYieldSurfaces > YieldSurfResArr;
+      /// Layout of the former public member yieldSurfaceCombinations: row i is mask i + 1, last column the used flag
+      typedef Eigen::Array< bool, ( 1 << nYieldSurfaces ) - 1, ( nYieldSurfaces + 1 ) > YieldSurfaceCombinationTable;
 
       YieldSurfaceCombinationManager();
-      /// get another unused combination of yield surfaces
+      /// get another unused combination of yield surfaces, in ascending order of the masks
       bool getAnotherYieldFlagCombination( YieldSurfFlagArr& activeSurfaces );
+      /**
+       * get another unused combination of yield surfaces, ordered by the trial values of the yield functions.
+       *
+       * The combination with the least mismatch is returned, where the mismatch is the sum of the negative trial values
+       * of active surfaces and the positive trial values of inactive surfaces (ties are resolved by fewer active
+       * surfaces). Hence, the set of violated surfaces is tried first.
+       */
+      bool getAnotherYieldFlagCombination( YieldSurfFlagArr&      activeSurfaces,
+                                           const YieldSurfResArr& trialYieldFunctions );
       /// set the current combination as used
       void markYieldFlagCombinationAsUsed( const YieldSurfFlagArr& activeSurfaces );
       /// reset all yieldsurfaces as unused
       void resetUsedYieldFlagCombinations();
+
+      /// convert active/nonactive states to a bitmask
+      static std::uint32_t toMask( const YieldSurfFlagArr& activeSurfaces );
+      /// convert a bitmask to active/nonactive states
+      static YieldSurfFlagArr toFlags( std::uint32_t mask );
+
+      /**
+       * Rebuild the table of the former public member yieldSurfaceCombinations from the masks. It is a copy, i.e.,
+       * combinations are marked as used only by @ref markYieldFlagCombinationAsUsed.
+       */
+      [[deprecated( "use getAnotherYieldFlagCombination and toFlags instead" )]] YieldSurfaceCombinationTable
+      getYieldSurfaceCombinations() const;
+
+    private:
+      std::bitset< nMasks > usedCombinations;
     };
   } // namespace NumericalAlgorithms
 } // namespace Marmot
@@ -60,44 +92,103 @@ namespace Marmot {
 namespace Marmot {
   namespace NumericalAlgorithms {
     template < int n >
-    YieldSurfaceCombinationManager< n >::YieldSurfaceCombinationManager() : idxUsedFlag( n )
+    YieldSurfaceCombinationManager< n >::YieldSurfaceCombinationManager()
+    {
+      // the empty combination is never a candidate
+      usedCombinations.set( 0 );
+    }
+
+    template < int n >
+    std::uint32_t YieldSurfaceCombinationManager< n >::toMask( const YieldSurfFlagArr& activeSurfaces )
     {
-      yieldSurfaceCombinations.setZero();
-      const int numRows = ( 1 << n ) - 1;
-      const int numCols = n;
-
-      for ( int row = 0; row < numRows; row++ )
-        for ( int col = 0; col < numCols; col++ )
-          yieldSurfaceCombinations( row, col ) = ( row + 1 ) & 1 << ( col );
-      return;
+      std::uint32_t mask = 0;
+      for ( int i = 0; i < n; i++ )
+        if ( activeSurfaces( i ) )
+          mask |= 1u << i;
+      return mask;
+    }
+
+    template < int n >
+    typename YieldSurfaceCombinationManager< n >::YieldSurfFlagArr YieldSurfaceCombinationManager< n >::toFlags(
+      std::uint32_t mask )
+    {
+      YieldSurfFlagArr activeSurfaces;
+      for ( int i = 0; i < n; i++ )
+        activeSurfaces( i ) = mask & 1u << i;
+      return activeSurfaces;
     }
 
     template < int n >
     bool YieldSurfaceCombinationManager< n >::getAnotherYieldFlagCombination( YieldSurfFlagArr& activeSurfaces )
     {
-      for ( int i = 0; i < yieldSurfaceCombinations.rows(); i++ ) {
-        bool             alreadyUsed          = yieldSurfaceCombinations.row( i )( idxUsedFlag );
-        YieldSurfFlagArr combinationCandidate = yieldSurfaceCombinations.row( i ).head( n );
-        if ( !alreadyUsed && ( combinationCandidate == true ).any() ) {
-          activeSurfaces = combinationCandidate;
+      for ( std::uint32_t mask = 1; mask < nMasks; mask++ )
+        if ( !usedCombinations.test( mask ) ) {
+          activeSurfaces = toFlags( mask );
           return true;
         }
-      }
       return false;
     }
 
+    template < int n >
+    bool YieldSurfaceCombinationManager< n >::getAnotherYieldFlagCombination(
+      YieldSurfFlagArr&      activeSurfaces,
+      const YieldSurfResArr& trialYieldFunctions )
+    {
+      std::uint32_t bestMask          = 0;
+      double        bestMismatch      = std::numeric_limits< double >::infinity();
+      size_t        bestNumberOfFlags = n + 1;
+
+      for ( std::uint32_t mask = 1; mask < nMasks; mask++ ) {
+        if ( usedCombinations.test( mask ) )
+          continue;
+
+        double mismatch = 0;
+        for ( int i = 0; i < n; i++ ) {
+          const bool active = mask & 1u << i;
+          if ( active && trialYieldFunctions( i ) < 0 )
+            mismatch -= trialYieldFunctions( i );
+          else if ( !active && trialYieldFunctions( i ) > 0 )
+            mismatch += trialYieldFunctions( i );
+        }
+
+        const size_t numberOfFlags = std::bitset< n >( mask ).count();
+        if ( mismatch < bestMismatch || ( mismatch == bestMismatch && numberOfFlags < bestNumberOfFlags ) ) {
+          bestMask          = mask;
+          bestMismatch      = mismatch;
+          bestNumberOfFlags = numberOfFlags;
+        }
+      }
+
+      if ( bestMask == 0 )
+        return false;
+
+      activeSurfaces = toFlags( bestMask );
+      return true;
+    }
+
     template < int n >
     void YieldSurfaceCombinationManager< n >::resetUsedYieldFlagCombinations()
     {
-      yieldSurfaceCombinations.col( idxUsedFlag ).setConstant( false );
+      usedCombinations.reset();
+      usedCombinations.set( 0 );
+    }
+
+    template < int n >
+    typename YieldSurfaceCombinationManager< n >::YieldSurfaceCombinationTable YieldSurfaceCombinationManager<
+      n >::getYieldSurfaceCombinations() const
+    {
+      YieldSurfaceCombinationTable table;
+      for ( std::uint32_t mask = 1; mask < nMasks; mask++ ) {
+        table.row( mask - 1 ).head( n ) = toFlags( mask );
+        table( mask - 1, n )            = usedCombinations.test( mask );
+      }
+      return table;
     }
 
     template < int n >
     void YieldSurfaceCombinationManager< n >::markYieldFlagCombinationAsUsed( const YieldSurfFlagArr& activeSurfaces )
     {
-      for ( int i = 0; i < yieldSurfaceCombinations.rows(); i++ )
-        if ( ( yieldSurfaceCombinations.row( i ).head( n ) == activeSurfaces ).all() )
-          yieldSurfaceCombinations.row( i )( idxUsedFlag ) = true;
+      usedCombinations.set( toMask( activeSurfaces ) );
     }
   } // namespace NumericalAlgorithms
 } // namespace Marmot
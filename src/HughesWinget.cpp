@@ -8,15 +8,8 @@ namespace Marmot::NumericalAlgorithms {
   HughesWinget::HughesWinget( const Matrix3d& FOld, const Matrix3d& FNew, Formulation formulation )
     : theFormulation( formulation )
   {
-
-    Matrix3d FMidStep = 0.5 * ( FNew + FOld );
-
-    l = ( FNew - FOld ) * FMidStep.inverse(); // actually l * dT
-
-    Matrix3d dEps_ = 0.5 * ( l + l.transpose() ); // actually d * dT
-    dOmega         = 0.5 * ( l - l.transpose() ); // actually omega * dT
-    dEps           = Marmot::ContinuumMechanics::VoigtNotation::voigtFromStrainMatrix( dEps_ );
-    dR             = ( Matrix3d::Identity() - 0.5 * dOmega ).inverse() * ( Matrix3d::Identity() + 0.5 * dOmega );
+    // the shared kernel keeps the scalar class bit-compatible with HughesWingetBatch
+    computeHughesWingetKinematics( FOld.data(), FNew.data(), l.data(), dEps.data(), dOmega.data(), dR.data() );
   }
 
   Marmot::Vector6d HughesWinget::getStrainIncrement()
@@ -31,9 +24,9 @@ namespace Marmot::NumericalAlgorithms {
 
   Marmot::Vector6d HughesWinget::rotateTensor( const Marmot::Vector6d& tensor )
   {
-
-    return Marmot::ContinuumMechanics::VoigtNotation::stressToVoigt< double >(
-      dR * Marmot::ContinuumMechanics::VoigtNotation::voigtToStress( tensor ) * dR.transpose() );
+    Marmot::Vector6d rotated = tensor;
+    rotateVoigtStressHughesWinget( dR.data(), rotated.data() );
+    return rotated;
   }
 
   Marmot::EigenTensors::Tensor633d HughesWinget::compute_dS_dF( const Marmot::Vector6d& stress,
@@ -79,6 +72,42 @@ namespace Marmot::NumericalAlgorithms {
     return dS_dF;
   }
 
+  void HughesWinget::compute_dS_dF( double*                 dS_dF_,
+                                    const Marmot::Vector6d& stress,
+                                    const Matrix3d&         FInv,
+                                    const Marmot::Matrix6d& dChauchydEps )
+  {
+    using namespace Marmot;
+    using namespace Marmot::ContinuumMechanics::TensorUtility;
+
+    // Voigt index of the symmetric part of l(k,l)
+    // clang-format off
+    constexpr int voigtKL[3][3] = { { 0, 3, 4 },
+                                    { 3, 1, 5 },
+                                    { 4, 5, 2 } };
+    // clang-format on
+
+    const Matrix3d stressNew = ContinuumMechanics::VoigtNotation::stressMatrixFromVoigt< 3 >( stress );
+
+    Matrix3d dSij_dl;
+    for ( int ij = 0; ij < 6; ij++ ) {
+      auto [i, j] = IndexNotation::fromVoigt< 3 >( ij );
+
+      // Jaumann part
+      for ( int l = 0; l < 3; l++ )
+        for ( int k = 0; k < 3; k++ )
+          dSij_dl( k, l ) = dChauchydEps( ij, voigtKL[k][l] );
+
+      // rotational part, using the symmetry of the stress
+      dSij_dl.row( i ) += 0.5 * stressNew.row( j );
+      dSij_dl.col( i ) -= 0.5 * stressNew.col( j );
+      dSij_dl.row( j ) += 0.5 * stressNew.row( i );
+      dSij_dl.col( j ) -= 0.5 * stressNew.col( i );
+
+      Map< Matrix3d, 0, Stride< 18, 6 > >( dS_dF_ + ij ) = dSij_dl * FInv.transpose();
+    }
+  }
+
   Eigen::Matrix3d HughesWinget::compute_dScalar_dF( const Eigen::Matrix3d& FInv, const Marmot::Vector6d& dScalarDEps )
   {
 
@@ -1,4 +1,6 @@
 #include "Marmot/MarmotKelvinChain.h"
+#include <algorithm>
+#include <limits>
 
 namespace Marmot::Materials {
 
@@ -15,42 +17,129 @@ namespace Marmot::Materials {
       return retardationTimes;
     }
 
-    void evaluateKelvinChain( double         dT,
-                              Properties     elasticModuli,
-                              Properties     retardationTimes,
-                              StateVarMatrix stateVars,
-                              double&        uniaxialCompliance,
-                              Vector6d&      dStrain,
-                              const double   factor )
+    namespace {
+
+      /**
+       * Solve min || A x - b || subject to x >= 0 by the active set method of Lawson & Hanson.
+       */
+      VectorXd solveNonNegativeLeastSquares( const MatrixXd& A, const VectorXd& b )
+      {
+        const Index n = A.cols();
+
+        VectorXd            x = VectorXd::Zero( n );
+        std::vector< int >  passive;
+        std::vector< bool > isPassive( n, false );
+
+        const double tolerance     = 1e-12 * A.norm() * b.norm();
+        const int    maxIterations = 3 * static_cast< int >( n );
+
+        for ( int iteration = 0; iteration < maxIterations; iteration++ ) {
+          const VectorXd w = A.transpose() * ( b - A * x );
+
+          Index  next = -1;
+          double wMax = tolerance;
+          for ( Index j = 0; j < n; j++ )
+            if ( !isPassive[j] && w( j ) > wMax ) {
+              wMax = w( j );
+              next = j;
+            }
+          if ( next < 0 )
+            break;
+
+          passive.push_back( static_cast< int >( next ) );
+          isPassive[next] = true;
+
+          while ( true ) {
+            // unconstrained solution on the passive set
+            MatrixXd AP( A.rows(), passive.size() );
+            for ( size_t j = 0; j < passive.size(); j++ )
+              AP.col( j ) = A.col( passive[j] );
+            const VectorXd z = AP.colPivHouseholderQr().solve( b );
+
+            if ( ( z.array() > 0 ).all() ) {
+              for ( size_t j = 0; j < passive.size(); j++ )
+                x( passive[j] ) = z( j );
+              break;
+            }
+
+            // step towards z until the first passive variable hits zero, and make it active again
+            double alpha = 1.;
+            for ( size_t j = 0; j < passive.size(); j++ )
+              if ( z( j ) <= 0 )
+                alpha = std::min( alpha, x( passive[j] ) / ( x( passive[j] ) - z( j ) ) );
+
+            for ( size_t j = 0; j < passive.size(); j++ )
+              x( passive[j] ) += alpha * ( z( j ) - x( passive[j] ) );
+
+            for ( size_t j = 0; j < passive.size(); )
+              if ( x( passive[j] ) <= 1e-14 * x.cwiseAbs().maxCoeff() ) {
+                x( passive[j] )       = 0;
+                isPassive[passive[j]] = false;
+                passive.erase( passive.begin() + j );
+              }
+              else
+                j++;
+          }
+        }
+
+        return x;
+      }
+
+      /**
+       * The units are processed in chunks, such that the coefficients of a chunk fit into fixed size buffers on the
+       * stack.
+       */
+      constexpr int chunkSize = 32;
+
+      typedef Eigen::Matrix< double, Eigen::Dynamic, 1, Eigen::ColMajor, chunkSize, 1 > ChunkProperties;
+    } // namespace
+
+    void evaluateKelvinChain( const double                       dT,
+                              const Ref< const Properties >&     elasticModuli,
+                              const Ref< const Properties >&     retardationTimes,
+                              const Ref< const StateVarMatrix >& stateVars,
+                              double&                            uniaxialCompliance,
+                              Vector6d&                          dStrain,
+                              const double                       factor )
     {
+      const int n = static_cast< int >( retardationTimes.size() );
 
-      for ( int i = 0; i < retardationTimes.size(); i++ ) {
-        const double& tau = retardationTimes( i );
-        const double& D   = elasticModuli( i );
+      for ( int first = 0; first < n; first += chunkSize ) {
+        const int       m = std::min( chunkSize, n - first );
+        ChunkProperties lambda( m ), beta( m );
+        computeLambdaAndBeta( dT, retardationTimes.segment( first, m ), lambda, beta );
 
-        double lambda, beta;
-        computeLambdaAndBeta( dT, tau, lambda, beta );
-        uniaxialCompliance += ( 1. - lambda ) / D * factor;
-        dStrain += ( 1. - beta ) * stateVars.col( i ) * factor;
+        uniaxialCompliance += factor * ( ( 1. - lambda.array() ) / elasticModuli.segment( first, m ).array() ).sum();
+
+        beta = ( 1. - beta.array() ) * factor;
+        dStrain.noalias() += stateVars.middleCols( first, m ) * beta;
       }
     }
 
-    void updateStateVarMatrix( double                dT,
-                               Properties            elasticModuli,
-                               Properties            retardationTimes,
-                               Ref< StateVarMatrix > stateVars,
-                               const Vector6d&       dStress,
-                               const Matrix6d&       unitComplianceMatrix )
+    void updateStateVarMatrix( const double                   dT,
+                               const Ref< const Properties >& elasticModuli,
+                               const Ref< const Properties >& retardationTimes,
+                               Ref< StateVarMatrix >          stateVars,
+                               const Vector6d&                dStress,
+                               const Matrix6d&                unitComplianceMatrix )
     {
 
       if ( dT <= 1e-14 )
         return;
-      for ( int i = 0; i < retardationTimes.size(); i++ ) {
-        const double& tau = retardationTimes( i );
-        const double& D   = elasticModuli( i );
-        double        lambda, beta;
-        computeLambdaAndBeta( dT, tau, lambda, beta );
-        stateVars.col( i ) = ( lambda / D ) * unitComplianceMatrix * dStress + beta * stateVars.col( i );
+
+      const Vector6d unitStrain = unitComplianceMatrix * dStress;
+      const int      n          = static_cast< int >( retardationTimes.size() );
+
+      for ( int first = 0; first < n; first += chunkSize ) {
+        const int       m = std::min( chunkSize, n - first );
+        ChunkProperties lambda( m ), beta( m );
+        computeLambdaAndBeta( dT, retardationTimes.segment( first, m ), lambda, beta );
+
+        lambda.array() /= elasticModuli.segment( first, m ).array();
+
+        auto units = stateVars.middleCols( first, m );
+        units.array().rowwise() *= beta.transpose().array();
+        units.noalias() += unitStrain * lambda.transpose();
       }
     }
 
@@ -72,5 +161,145 @@ namespace Marmot::Materials {
       }
     }
 
+    void computeLambdaAndBeta( double                         dT,
+                               const Ref< const Properties >& retardationTimes,
+                               Ref< Properties >              lambda,
+                               Ref< Properties >              beta )
+    {
+      beta   = ( -dT / retardationTimes.array() ).exp();
+      lambda = ( 1. - beta.array() ) * retardationTimes.array() / dT;
+
+      // respect extreme values according to Jirasek Bazant, which only affects the shortest and longest units
+      const double tauMin = dT / 30.0;
+      const double tauMax = dT / 1e-6;
+      for ( int i = 0; i < retardationTimes.size(); i++ ) {
+        if ( retardationTimes( i ) <= tauMin ) {
+          beta( i )   = 0.;
+          lambda( i ) = retardationTimes( i ) / dT;
+        }
+        else if ( retardationTimes( i ) > tauMax ) {
+          const double dT_tau = dT / retardationTimes( i );
+          beta( i )           = 1.0;
+          lambda( i )         = 1 - 0.5 * dT_tau + 1. / 6 * dT_tau * dT_tau;
+        }
+      }
+    }
+
+    Coefficients::Coefficients( double dT, const Ref< const Properties >& retardationTimes )
+    {
+      update( dT, retardationTimes );
+    }
+
+    void Coefficients::update( double dT, const Ref< const Properties >& retardationTimes )
+    {
+      this->dT               = dT;
+      this->retardationTimes = retardationTimes;
+      lambda.resize( retardationTimes.size() );
+      beta.resize( retardationTimes.size() );
+      computeLambdaAndBeta( dT, retardationTimes, lambda, beta );
+    }
+
+    bool Coefficients::matches( double dT, const Ref< const Properties >& retardationTimes ) const
+    {
+      return dT == this->dT && retardationTimes.size() == this->retardationTimes.size() &&
+             retardationTimes == this->retardationTimes;
+    }
+
+    const Coefficients& CoefficientCache::get( double dT, const Ref< const Properties >& retardationTimes )
+    {
+      for ( const Coefficients& entry : entries )
+        if ( entry.matches( dT, retardationTimes ) )
+          return entry;
+
+      Coefficients& entry = entries[oldest];
+      oldest              = ( oldest + 1 ) % nEntries;
+      entry.update( dT, retardationTimes );
+      return entry;
+    }
+
+    void evaluateKelvinChain( const Coefficients&                coefficients,
+                              const Ref< const Properties >&     elasticModuli,
+                              const Ref< const StateVarMatrix >& stateVars,
+                              double&                            uniaxialCompliance,
+                              Vector6d&                          dStrain,
+                              const double                       factor )
+    {
+      const Properties& lambda = coefficients.lambda;
+      const Properties& beta   = coefficients.beta;
+
+      uniaxialCompliance += factor * ( ( 1. - lambda.array() ) / elasticModuli.array() ).sum();
+
+      for ( int i = 0; i < beta.size(); i++ )
+        dStrain += ( factor * ( 1. - beta( i ) ) ) * stateVars.col( i );
+    }
+
+    void updateStateVarMatrix( const Coefficients&            coefficients,
+                               const Ref< const Properties >& elasticModuli,
+                               Ref< StateVarMatrix >          stateVars,
+                               const Vector6d&                dStress,
+                               const Matrix6d&                unitComplianceMatrix )
+    {
+      if ( coefficients.dT <= 1e-14 )
+        return;
+
+      const Properties& lambda     = coefficients.lambda;
+      const Properties& beta       = coefficients.beta;
+      const Vector6d    unitStrain = unitComplianceMatrix * dStress;
+
+      for ( int i = 0; i < beta.size(); i++ )
+        stateVars.col( i ) = ( lambda( i ) / elasticModuli( i ) ) * unitStrain + beta( i ) * stateVars.col( i );
+    }
+
+    Properties fitElasticModuli( const std::function< double( double ) >& phi,
+                                 const Ref< const Properties >&           retardationTimes,
+                                 double&                                  zerothCompliance,
+                                 int                                      samplesPerUnit )
+    {
+      const Index  n     = retardationTimes.size();
+      const Index  m     = samplesPerUnit * n;
+      const double tMin  = retardationTimes.minCoeff();
+      const double tMax  = retardationTimes.maxCoeff();
+      const double ratio = m > 1 ? std::pow( tMax / tMin, 1. / ( m - 1 ) ) : 1.;
+
+      // first column: zeroth compliance, further columns: compliances of the units
+      MatrixXd A( m, n + 1 );
+      VectorXd b( m );
+      double   t = tMin;
+      for ( Index j = 0; j < m; j++, t *= ratio ) {
+        A( j, 0 )            = 1.;
+        A.row( j ).tail( n ) = 1. - ( -t / retardationTimes.array() ).exp();
+        b( j )               = phi( t );
+      }
+
+      const VectorXd compliances = solveNonNegativeLeastSquares( A, b );
+
+      zerothCompliance = compliances( 0 );
+      return ( compliances.tail( n ).array() > 0 )
+        .select( compliances.tail( n ).array().inverse(), std::numeric_limits< double >::infinity() );
+    }
+
+    const FittedChainCache::Chain& FittedChainCache::get( const std::vector< double >&    complianceParameters,
+                                                          const Ref< const Properties >&  retardationTimes,
+                                                          const std::function< Chain() >& fit )
+    {
+      // the number of parameters is part of the key, such that parameters and retardation times cannot be confused
+      std::vector< double > key( 1, static_cast< double >( complianceParameters.size() ) );
+      key.insert( key.end(), complianceParameters.begin(), complianceParameters.end() );
+      key.insert( key.end(), retardationTimes.data(), retardationTimes.data() + retardationTimes.size() );
+
+      {
+        std::lock_guard< std::mutex > lock( mutex );
+        const auto                    it = chains.find( key );
+        if ( it != chains.end() )
+          return it->second;
+      }
+
+      Chain chain = fit();
+
+      // if another thread has fitted the same chain in the meantime, its result is kept
+      std::lock_guard< std::mutex > lock( mutex );
+      return chains.emplace( std::move( key ), std::move( chain ) ).first->second;
+    }
+
   } // namespace KelvinChain
 } // namespace Marmot::Materials
@@ -142,4 +142,26 @@ namespace Marmot::ContinuumMechanics {
     }
 
   } // namespace PlaneStress
+
+  namespace Condensation {
+
+    const Options defaultPlaneStressOptions = {
+      /*residualTolerance*/ 1e-10,
+      /*relaxedResidualTolerance*/ 1e-8,
+      /*iterationsBeforeRelaxedTolerance*/ 7,
+      /*maxIterations*/ 13,
+      /*lineSearch*/ false,
+      /*maxLineSearchSteps*/ 4,
+    };
+
+    const Options defaultUniaxialStressOptions = {
+      /*residualTolerance*/ 1e-13,
+      /*relaxedResidualTolerance*/ 1e-10,
+      /*iterationsBeforeRelaxedTolerance*/ 7,
+      /*maxIterations*/ 13,
+      /*lineSearch*/ false,
+      /*maxLineSearchSteps*/ 4,
+    };
+
+  } // namespace Condensation
 } // namespace Marmot::ContinuumMechanics
@@ -2,10 +2,13 @@
 #include "Marmot/MarmotConstants.h"
 #include "Marmot/MarmotJournal.h"
 #include "Marmot/MarmotKinematics.h"
+#include "Marmot/MarmotLowerDimensionalStress.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
 #include "Marmot/MarmotTensor.h"
 #include "Marmot/MarmotVoigt.h"
 #include <iostream>
+#include <typeinfo>
 
 using namespace Eigen;
 
@@ -18,18 +21,98 @@ void MarmotMaterialHyperElastic::computeStress( double*       Cauchy_,
                                                 double&       pNewDT_ )
 {
   using namespace Marmot;
-  using namespace Marmot::ContinuumMechanics::TensorUtility::IndexNotation;
 
-  Map< Vector6d >               Cauchy( Cauchy_ );
-  Map< Matrix< double, 6, 9 > > dCauchy_d_F_np( dCauchy_d_F_np_ );
-  const Map< const Matrix3d >   F_np( F_np_ );
-  Vector6d                      E = ContinuumMechanics::Kinematics::Strain::GreenLagrange( F_np );
+  const Map< const Matrix3d > F_np( F_np_ );
+  Vector6d                    E = ContinuumMechanics::Kinematics::Strain::GreenLagrange( F_np );
 
   Matrix6d dSdE;
   Vector6d S;
 
   computeStressPK2( S.data(), dSdE.data(), E.data(), timeOld_, dT_, pNewDT_ );
 
+  pushForwardPK2( Cauchy_, dCauchy_d_F_np_, S.data(), dSdE.data(), F_np_ );
+}
+
+void MarmotMaterialHyperElastic::pushForwardPK2( double*       Cauchy_,
+                                                 double*       dCauchy_dF_,
+                                                 const double* S_,
+                                                 const double* dSdE_,
+                                                 const double* F_ )
+{
+  using namespace Marmot;
+
+  // Voigt index tables
+  constexpr int voigtI[6] = { 0, 1, 2, 0, 0, 1 };
+  constexpr int voigtJ[6] = { 0, 1, 2, 1, 2, 2 };
+
+  Map< Vector6d >               Cauchy( Cauchy_ );
+  Map< Matrix< double, 6, 9 > > dCauchy_dF( dCauchy_dF_ );
+  const Vector6d                S = Map< const Vector6d >( S_ );
+  const Map< const Matrix6d >   dSdE( dSdE_ );
+  const Map< const Matrix3d >   F( F_ );
+
+  const double   J    = F.determinant();
+  const Matrix3d FInv = F.inverse();
+
+  // push forward operator for symmetric stress like tensors in Voigt notation: sigma_ij = P(ij,MN) * S_MN
+  Matrix6d P;
+  for ( int MN = 0; MN < 6; MN++ ) {
+    const int M = voigtI[MN];
+    const int N = voigtJ[MN];
+    for ( int ij = 0; ij < 6; ij++ ) {
+      const int i = voigtI[ij];
+      const int j = voigtJ[ij];
+      P( ij, MN ) = M == N ? F( i, M ) * F( j, N ) : F( i, M ) * F( j, N ) + F( i, N ) * F( j, M );
+    }
+  }
+
+  Cauchy = 1. / J * P * S;
+
+  // dE/dF (Voigt, strain notation) as 6x9 matrix, column k + 3L; only F(k,*) enters each column
+  Matrix< double, 6, 9 > dEdF = Matrix< double, 6, 9 >::Zero();
+  for ( int PQ = 0; PQ < 6; PQ++ ) {
+    const int P_ = voigtI[PQ];
+    const int Q  = voigtJ[PQ];
+    for ( int k = 0; k < 3; k++ ) {
+      dEdF( PQ, k + 3 * P_ ) += F( k, Q );
+      if ( P_ != Q )
+        dEdF( PQ, k + 3 * Q ) += F( k, P_ );
+    }
+  }
+
+  // material part
+  dCauchy_dF.noalias() = ( 1. / J * P * dSdE ) * dEdF;
+
+  // geometric part with B = S * F^T
+  const Matrix3d B      = ContinuumMechanics::VoigtNotation::voigtToStress( S ) * F.transpose();
+  const Matrix3d FInvT_ = FInv.transpose();
+
+  dCauchy_dF -= Cauchy * Map< const Matrix< double, 1, 9 > >( FInvT_.data() );
+
+  for ( int ij = 0; ij < 6; ij++ ) {
+    const int i = voigtI[ij];
+    const int j = voigtJ[ij];
+    for ( int L = 0; L < 3; L++ ) {
+      dCauchy_dF( ij, i + 3 * L ) += 1. / J * B( L, j );
+      dCauchy_dF( ij, j + 3 * L ) += 1. / J * B( L, i );
+    }
+  }
+}
+
+void MarmotMaterialHyperElastic::pushForwardPK2Reference( double*       Cauchy_,
+                                                          double*       dCauchy_d_F_np_,
+                                                          const double* PK2_,
+                                                          const double* dSdE_,
+                                                          const double* F_np_ )
+{
+  using namespace Marmot;
+  using namespace Marmot::ContinuumMechanics::TensorUtility::IndexNotation;
+
+  Map< Vector6d >             Cauchy( Cauchy_ );
+  const Map< const Matrix3d > F_np( F_np_ );
+  const Vector6d              S = Map< const Vector6d >( PK2_ );
+  const Map< const Matrix6d > dSdE( dSdE_ );
+
   double J = F_np.determinant();
 
   Matrix3d S_ = Marmot::ContinuumMechanics::VoigtNotation::voigtToStress( S );
@@ -69,15 +152,63 @@ void MarmotMaterialHyperElastic::computeStress( double*       Cauchy_,
   }
 }
 
-void MarmotMaterialHyperElastic::computePlaneStressPK2( double*       S2D,
-                                                        double*       dSdE2D,
-                                                        const double* E2D,
+void MarmotMaterialHyperElastic::computePlaneStressPK2( double*       S2D_,
+                                                        double*       dSdE2D_,
+                                                        const double* E2D_,
                                                         const double* timeOld,
                                                         const double  dT,
                                                         double&       pNewDT )
 
 {
-  throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << "not yet implemented" );
+  using namespace Marmot;
+  using namespace ContinuumMechanics::VoigtNotation;
+
+  Map< Vector3d >       S2D( S2D_ );
+  Map< Matrix3d >       dSdE2D( dSdE2D_ );
+  Map< const Vector3d > E2D( E2D_ );
+  Map< VectorXd >       stateVars( this->stateVars, this->nStateVars );
+
+  const VectorXd stateVarsOld = stateVars;
+
+  Matrix6d dSdE3D;
+  Vector6d S3D;
+  Vector6d E3D = make3DVoigt< VoigtSize::TwoD >( E2D );
+
+  // assumption of isochoric deformation for initial guess, C33 = 1 / det ( C2D ) with C = I + 2 E
+  const double detC2D = ( 1 + 2 * E2D( 0 ) ) * ( 1 + 2 * E2D( 1 ) ) - E2D( 2 ) * E2D( 2 );
+  E3D( 2 )            = 0.5 * ( 1. / detC2D - 1 );
+
+  auto computeStressPK2_3D = [&]( const Vector6d& E, Vector6d& S, Matrix6d& dSdE ) {
+    stateVars = stateVarsOld;
+
+    computeStressPK2( S.data(), dSdE.data(), E.data(), timeOld, dT, pNewDT );
+
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  const auto result = PlaneStressConstraint::solve( E3D,
+                                                    S3D,
+                                                    dSdE3D,
+                                                    Matrix< double, 1, 1 >::Zero(),
+                                                    computeStressPK2_3D,
+                                                    getPlaneStressOptions(),
+                                                    planeStressTelemetry,
+                                                    typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage planeStressCutback( "PlaneStressWrapper requires cutback",
+                                                           Journal::Severity::Warning );
+    planeStressCutback.report();
+    return;
+  }
+
+  S2D    = reduce3DVoigt< VoigtSize::TwoD >( S3D );
+  dSdE2D = ContinuumMechanics::PlaneStress::getPlaneStressTangent( dSdE3D );
 }
 
 void MarmotMaterialHyperElastic::computeUniaxialStressPK2( double*       S1D,
@@ -87,5 +218,50 @@ void MarmotMaterialHyperElastic::computeUniaxialStressPK2( double*       S1D,
                                                            const double  dT,
                                                            double&       pNewDT )
 {
-  throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << "not yet implemented" );
+  using namespace Marmot;
+
+  Map< VectorXd > stateVars( this->stateVars, this->nStateVars );
+
+  const VectorXd stateVarsOld = stateVars;
+
+  Matrix6d dSdE3D;
+  Vector6d S3D;
+  Vector6d E3D = Vector6d::Zero();
+  E3D( 0 )     = E1D[0];
+
+  // assumption of isochoric deformation with equal lateral contraction for initial guess, C22 = C33 = 1 / sqrt( C11 )
+  E3D( 1 ) = 0.5 * ( 1. / std::sqrt( 1 + 2 * E1D[0] ) - 1 );
+  E3D( 2 ) = E3D( 1 );
+
+  auto computeStressPK2_3D = [&]( const Vector6d& E, Vector6d& S, Matrix6d& dSdE ) {
+    stateVars = stateVarsOld;
+
+    computeStressPK2( S.data(), dSdE.data(), E.data(), timeOld, dT, pNewDT );
+
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  const auto result = UniaxialStressConstraint::solve( E3D,
+                                                       S3D,
+                                                       dSdE3D,
+                                                       Vector2d::Zero(),
+                                                       computeStressPK2_3D,
+                                                       getUniaxialStressOptions(),
+                                                       uniaxialStressTelemetry,
+                                                       typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage uniaxialStressCutback( "UniaxialStressWrapper requires cutback",
+                                                              Journal::Severity::Warning );
+    uniaxialStressCutback.report();
+    return;
+  }
+
+  S1D[0]    = S3D( 0 );
+  dSdE1D[0] = ContinuumMechanics::UniaxialStress::getUniaxialStressTangent( dSdE3D );
 }
@@ -4,12 +4,61 @@
 #include "Marmot/MarmotKinematics.h"
 #include "Marmot/MarmotLowerDimensionalStress.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
 #include "Marmot/MarmotTensor.h"
 #include "Marmot/MarmotVoigt.h"
 #include <iostream>
+#include <typeinfo>
+#include <vector>
 
 using namespace Eigen;
 
+namespace {
+  /**
+   * Thread local scratch arena for backing up the state vars in the lower dimensional stress wrappers. It grows to the
+   * largest requested size and is never shrunk, hence it does not allocate in steady state. The wrappers must not be
+   * nested within the same thread.
+   */
+  double* stateVarsBackupArena( const int size )
+  {
+    thread_local std::vector< double > arena;
+    if ( static_cast< size_t >( size ) > arena.size() )
+      arena.resize( size );
+    return arena.data();
+  }
+
+  /**
+   * Thread local buffer for the contiguous state vars of a single point in @ref
+   * MarmotMaterialHypoElastic::computeStressBatch. As the arena above, it does not allocate in steady state.
+   */
+  double* pointStateVarsArena( const int size )
+  {
+    thread_local std::vector< double > arena;
+    if ( static_cast< size_t >( size ) > arena.size() )
+      arena.resize( size );
+    return arena.data();
+  }
+
+  /// Restores the original state vars assignment of a material on scope exit, also if an exception is thrown
+  class StateVarsAssignmentGuard {
+  public:
+    StateVarsAssignmentGuard( MarmotMaterialHypoElastic& material, double* stateVars, const int nStateVars )
+      : material( material ), stateVars( stateVars ), nStateVars( nStateVars )
+    {
+    }
+
+    ~StateVarsAssignmentGuard() { material.assignStateVars( stateVars, nStateVars ); }
+
+    StateVarsAssignmentGuard( const StateVarsAssignmentGuard& )            = delete;
+    StateVarsAssignmentGuard& operator=( const StateVarsAssignmentGuard& ) = delete;
+
+  private:
+    MarmotMaterialHypoElastic& material;
+    double* const              stateVars;
+    const int                  nStateVars;
+  };
+} // namespace
+
 void MarmotMaterialHypoElastic::setCharacteristicElementLength( double length )
 {
   characteristicElementLength = length;
@@ -46,9 +95,63 @@ void MarmotMaterialHypoElastic::computeStress( double*       stress_,
 
   computeStress( stress.data(), CJaumann.data(), dEps.data(), timeOld, dT, pNewDT );
 
-  TensorMap< Eigen::Tensor< double, 3 > > dS_dF( dStressDDDeformationGradient_, 6, 3, 3 );
+  hughesWingetIntegrator.compute_dS_dF( dStressDDDeformationGradient_, stress, FNew.inverse(), CJaumann );
+}
+
+void MarmotMaterialHypoElastic::computeStressBatch( const int     nPoints,
+                                                    double*       stress_,
+                                                    double*       dStressDDStrain_,
+                                                    const double* dStrain_,
+                                                    double*       stateVars_,
+                                                    const double* timeOld,
+                                                    const double  dT,
+                                                    double&       pNewDT )
+{
+  using namespace Marmot;
+
+  Map< Matrix< double, Dynamic, 6 > >       stress( stress_, nPoints, 6 );
+  Map< Matrix< double, Dynamic, 36 > >      dStressDDStrain( dStressDDStrain_, nPoints, 36 );
+  Map< const Matrix< double, Dynamic, 6 > > dStrain( dStrain_, nPoints, 6 );
+  Map< Matrix< double, Dynamic, Dynamic > > stateVarsBatch( stateVars_, nPoints, this->nStateVars );
+
+  // the per-point implementation works on the assigned state vars, hence each point is assigned a contiguous copy
+  const int                nStateVarsAssigned = this->nStateVars;
+  StateVarsAssignmentGuard restoreAssignment( *this, this->stateVars, nStateVarsAssigned );
+  Map< VectorXd >          stateVarsPoint( pointStateVarsArena( nStateVarsAssigned ), nStateVarsAssigned );
+
+  Vector6d stressPoint;
+  Matrix6d dStressDDStrainPoint;
+  Vector6d dStrainPoint;
+
+  for ( int p = 0; p < nPoints; p++ ) {
+    stressPoint    = stress.row( p ).transpose();
+    dStrainPoint   = dStrain.row( p ).transpose();
+    stateVarsPoint = stateVarsBatch.row( p ).transpose();
+    assignStateVars( stateVarsPoint.data(), nStateVarsAssigned );
+
+    double pNewDTPoint = pNewDT;
+    computeStress( stressPoint.data(), dStressDDStrainPoint.data(), dStrainPoint.data(), timeOld, dT, pNewDTPoint );
+
+    if ( pNewDTPoint < pNewDT )
+      pNewDT = pNewDTPoint;
+
+    if ( pNewDT < 1.0 )
+      break;
+
+    stress.row( p )          = stressPoint.transpose();
+    dStressDDStrain.row( p ) = Map< const Matrix< double, 1, 36 > >( dStressDDStrainPoint.data() );
+    stateVarsBatch.row( p )  = stateVarsPoint.transpose();
+  }
+}
+
+StateView MarmotMaterialHypoElastic::getMutableStateVars()
+{
+  return { this->stateVars, this->nStateVars };
+}
 
-  dS_dF = hughesWingetIntegrator.compute_dS_dF( stress, FNew.inverse(), CJaumann );
+double* MarmotMaterialHypoElastic::getPlaneStressStrainRatio()
+{
+  return nullptr;
 }
 
 void MarmotMaterialHypoElastic::computePlaneStress( double*       stress2D_,
@@ -64,48 +167,55 @@ void MarmotMaterialHypoElastic::computePlaneStress( double*       stress2D_,
   Map< const Matrix< double, 3, 1 > > dStrain2D( dStrain2D_ );
   Map< Matrix< double, 3, 1 > >       stress2D( stress2D_ );
   Map< Matrix< double, 3, 3 > >       dStress_dStrain2D( dStress_dStrain2D_ );
-  Map< VectorXd >                     stateVars( this->stateVars, this->nStateVars );
+
+  const StateView mutableStateVars = getMutableStateVars();
+  Map< VectorXd > stateVars( mutableStateVars.stateLocation, mutableStateVars.stateSize );
+  Map< VectorXd > stateVarsOld( stateVarsBackupArena( mutableStateVars.stateSize ), mutableStateVars.stateSize );
+  stateVarsOld = stateVars;
 
   Matrix6d dStress_dStrain3D;
 
   Vector6d stress3DTemp;
-  VectorXd stateVarsOld  = stateVars;
   Vector6d dStrain3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( dStrain2D );
 
-  // assumption of isochoric deformation for initial guess
-  dStrain3DTemp( 2 ) = ( -dStrain2D( 0 ) - dStrain2D( 1 ) );
-
-  int planeStressCount = 1;
-  while ( true ) {
-    stress3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( stress2D );
-    stateVars    = stateVarsOld;
-
-    computeStress( stress3DTemp.data(), dStress_dStrain3D.data(), dStrain3DTemp.data(), timeOld, dT, pNewDT );
-
-    if ( pNewDT < 1.0 ) {
-      return;
-    }
-
-    double residual = stress3DTemp.array().abs()[2];
-
-    if ( residual < 1.e-10 || ( planeStressCount > 7 && residual < 1e-8 ) ) {
-      break;
-    }
-
-    double tangentCompliance = 1. / dStress_dStrain3D( 2, 2 );
-    if ( Math::isNaN( tangentCompliance ) || std::abs( tangentCompliance ) > 1e10 )
-      tangentCompliance = 1e10;
-
-    dStrain3DTemp[2] -= tangentCompliance * stress3DTemp[2];
-
-    planeStressCount += 1;
-    if ( planeStressCount > 13 ) {
-      pNewDT = 0.25;
-      MarmotJournal::warningToMSG( "PlaneStressWrapper requires cutback" );
-      return;
-    }
+  // initial guess from the converged ratio of the previous increment, or the assumption of isochoric deformation
+  double* const outOfPlaneStrainRatio   = getPlaneStressStrainRatio();
+  const double  inPlaneVolumetricStrain = dStrain2D( 0 ) + dStrain2D( 1 );
+  dStrain3DTemp( 2 ) = ( outOfPlaneStrainRatio ? *outOfPlaneStrainRatio : -1.0 ) * inPlaneVolumetricStrain;
+
+  auto computeStress3D = [&]( const Vector6d& dStrain, Vector6d& stress, Matrix6d& dStress_dStrain ) {
+    stress    = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( stress2D );
+    stateVars = stateVarsOld;
+
+    computeStress( stress.data(), dStress_dStrain.data(), dStrain.data(), timeOld, dT, pNewDT );
+
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  const auto result = PlaneStressConstraint::solve( dStrain3DTemp,
+                                                    stress3DTemp,
+                                                    dStress_dStrain3D,
+                                                    Matrix< double, 1, 1 >::Zero(),
+                                                    computeStress3D,
+                                                    getPlaneStressOptions(),
+                                                    planeStressTelemetry,
+                                                    typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage planeStressCutback( "PlaneStressWrapper requires cutback",
+                                                           Journal::Severity::Warning );
+    planeStressCutback.report();
+    return;
   }
 
+  if ( outOfPlaneStrainRatio && std::abs( inPlaneVolumetricStrain ) > 1e-14 )
+    *outOfPlaneStrainRatio = dStrain3DTemp( 2 ) / inPlaneVolumetricStrain;
+
   stress2D          = ContinuumMechanics::VoigtNotation::reduce3DVoigt< VoigtSize::TwoD >( stress3DTemp );
   dStress_dStrain2D = ContinuumMechanics::PlaneStress::getPlaneStressTangent( dStress_dStrain3D );
 }
@@ -123,40 +233,45 @@ void MarmotMaterialHypoElastic::computeUniaxialStress( double* stress1D_,
 
   Map< const Matrix< double, 1, 1 > > dStrain1D( dStrain1D_ );
   Map< Matrix< double, 1, 1 > >       stress1D( stress1D_ );
-  Map< VectorXd >                     stateVars( this->stateVars, this->nStateVars );
+
+  const StateView mutableStateVars = getMutableStateVars();
+  Map< VectorXd > stateVars( mutableStateVars.stateLocation, mutableStateVars.stateSize );
+  Map< VectorXd > stateVarsOld( stateVarsBackupArena( mutableStateVars.stateSize ), mutableStateVars.stateSize );
+  stateVarsOld = stateVars;
 
   Matrix6d dStress_dStrain3D;
 
   Vector6d stress3DTemp;
-  VectorXd stateVarsOld  = stateVars;
   Vector6d dStrain3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::OneD >( dStrain1D );
 
-  int count = 1;
-  while ( true ) {
-    stress3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::OneD >( stress1D );
-    stateVars    = stateVarsOld;
-
-    computeStress( stress3DTemp.data(), dStress_dStrain3D.data(), dStrain3DTemp.data(), timeOld, dT, pNewDT );
-
-    if ( pNewDT < 1.0 ) {
-      return;
-    }
-
-    const double residual = stress3DTemp.array().abs().segment( 1, 2 ).sum();
-
-    if ( residual < 1.e-13 || ( count > 7 && residual < 1e-10 ) ) {
-      break;
-    }
-
-    dStrain3DTemp.segment< 2 >( 1 ) -= dStress_dStrain3D.block< 2, 2 >( 1, 1 ).colPivHouseholderQr().solve(
-      stress3DTemp.segment< 2 >( 1 ) );
-
-    count += 1;
-    if ( count > 13 ) {
-      pNewDT = 0.25;
-      MarmotJournal::warningToMSG( "UniaxialStressWrapper requires cutback" );
-      return;
-    }
+  auto computeStress3D = [&]( const Vector6d& dStrain, Vector6d& stress, Matrix6d& dStress_dStrain ) {
+    stress    = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::OneD >( stress1D );
+    stateVars = stateVarsOld;
+
+    computeStress( stress.data(), dStress_dStrain.data(), dStrain.data(), timeOld, dT, pNewDT );
+
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  const auto result = UniaxialStressConstraint::solve( dStrain3DTemp,
+                                                       stress3DTemp,
+                                                       dStress_dStrain3D,
+                                                       Vector2d::Zero(),
+                                                       computeStress3D,
+                                                       getUniaxialStressOptions(),
+                                                       uniaxialStressTelemetry,
+                                                       typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage uniaxialStressCutback( "UniaxialStressWrapper requires cutback",
+                                                              Journal::Severity::Warning );
+    uniaxialStressCutback.report();
+    return;
   }
 
   stress1D              = ContinuumMechanics::VoigtNotation::reduce3DVoigt< VoigtSize::OneD >( stress3DTemp );
@@ -4,8 +4,10 @@
 #include "Marmot/MarmotLowerDimensionalStress.h"
 #include "Marmot/MarmotMaterialGradientEnhancedHypoElastic.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
 #include "Marmot/MarmotTensor.h"
 #include "Marmot/MarmotVoigt.h"
+#include <typeinfo>
 
 using namespace Eigen;
 
@@ -55,12 +57,11 @@ void MarmotMaterialGradientEnhancedHypoElastic::computeStress( double*       str
                  dT,
                  pNewDT );
 
-  TensorMap< Eigen::Tensor< double, 3 > > dS_dF( dStressDDDeformationGradient_, 6, 3, 3 );
-  Map< Matrix3d >                         dKLocal_dF( dK_localDDeformationGradient_ );
+  Map< Matrix3d > dKLocal_dF( dK_localDDeformationGradient_ );
 
   Matrix3d FInv = FNew.inverse();
-  dS_dF         = hughesWingetIntegrator.compute_dS_dF( stress, FInv, CJaumann );
-  dKLocal_dF    = hughesWingetIntegrator.compute_dScalar_dF( FInv, dK_LocalDStretchingRate );
+  hughesWingetIntegrator.compute_dS_dF( dStressDDDeformationGradient_, stress, FInv, CJaumann );
+  dKLocal_dF = hughesWingetIntegrator.compute_dScalar_dF( FInv, dK_LocalDStretchingRate );
 }
 
 void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*       stress2D_,
@@ -97,46 +98,45 @@ void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*
   // assumption of isochoric deformation for initial guess
   dStrain3DTemp( 2 ) = ( -dStrain2D( 0 ) - dStrain2D( 1 ) );
 
-  int planeStressCount = 1;
-  while ( true ) {
-    stressTemp3D = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( stress2D );
-    stateVars    = stateVarsOld;
+  auto computeStress3D = [&]( const Vector6d& dStrain, Vector6d& stress, Matrix6d& dStress_dStrain ) {
+    stress    = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt< VoigtSize::TwoD >( stress2D );
+    stateVars = stateVarsOld;
 
-    computeStress( stressTemp3D.data(),
+    computeStress( stress.data(),
                    KLocal,
                    nonLocalRadius,
-                   dStress_dStrain3D.data(),
+                   dStress_dStrain.data(),
                    dKLocal_dStrain3D.data(),
                    dStress_dK3D.data(),
-                   dStrain3DTemp.data(),
+                   dStrain.data(),
                    KOld,
                    dK,
                    timeOld,
                    dT,
                    pNewDT );
 
-    if ( pNewDT < 1.0 ) {
-      return;
-    }
-
-    double residual = stressTemp3D.array().abs()[2];
-
-    if ( residual < 1.e-10 || ( planeStressCount > 7 && residual < 1e-5 ) ) {
-      break;
-    }
-
-    double tangentCompliance = 1. / dStress_dStrain3D( 2, 2 );
-    if ( Math::isNaN( tangentCompliance ) || std::abs( tangentCompliance ) > 1e10 )
-      tangentCompliance = 1e10;
-
-    dStrain3DTemp[2] -= tangentCompliance * stressTemp3D[2];
-
-    planeStressCount += 1;
-    if ( planeStressCount > 10 ) {
-      pNewDT = 0.25;
-      MarmotJournal::warningToMSG( "PlaneStressWrapper requires cutback" );
-      return;
-    }
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  const auto result = PlaneStressConstraint::solve( dStrain3DTemp,
+                                                    stressTemp3D,
+                                                    dStress_dStrain3D,
+                                                    Matrix< double, 1, 1 >::Zero(),
+                                                    computeStress3D,
+                                                    getPlaneStressOptions(),
+                                                    planeStressTelemetry,
+                                                    typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage planeStressCutback( "PlaneStressWrapper requires cutback",
+                                                           Journal::Severity::Warning );
+    planeStressCutback.report();
+    return;
   }
 
   stress2D = ContinuumMechanics::VoigtNotation::reduce3DVoigt< VoigtSize::TwoD >( stressTemp3D );
@@ -145,3 +145,9 @@ void MarmotMaterialGradientEnhancedHypoElastic::computePlaneStress( double*
   dKLocal_dStrain2D = ContinuumMechanics::VoigtNotation::reduce3DVoigt< VoigtSize::TwoD >( dKLocal_dStrain3D );
   dStress_dK2D      = ContinuumMechanics::VoigtNotation::reduce3DVoigt< VoigtSize::TwoD >( dStress_dK3D );
 }
+
+const Marmot::ContinuumMechanics::Condensation::Options& MarmotMaterialGradientEnhancedHypoElastic::
+  getPlaneStressOptions()
+{
+  return Marmot::ContinuumMechanics::Condensation::defaultPlaneStressOptions;
+}
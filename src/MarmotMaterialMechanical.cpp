@@ -2,8 +2,10 @@
 #include "Marmot/MarmotJournal.h"
 #include "Marmot/MarmotLowerDimensionalStress.h"
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotRateLimitedJournal.h"
 #include "Marmot/MarmotVoigt.h"
 #include <iostream>
+#include <typeinfo>
 
 using namespace Eigen;
 
@@ -57,9 +59,11 @@ void MarmotMaterialMechanical::computePlaneStress( double*       stress2D_,
 
   EigenTensors::Tensor633d dStress_dDeformationGradient3D;
 
-  int planeStressCount = 1;
-  while ( true ) {
-    stress3DTemp = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt<
+  auto evaluate = [&]( const Matrix< double, 1, 1 >& F33,
+                       Matrix< double, 1, 1 >&       residual,
+                       Matrix< double, 1, 1 >&       dS33_dF33 ) {
+    FNew3D( 2, 2 ) = F33( 0 );
+    stress3DTemp   = Marmot::ContinuumMechanics::VoigtNotation::make3DVoigt<
       Marmot::ContinuumMechanics::VoigtNotation::VoigtSize::TwoD >( stress2D );
     stateVars = stateVarsOld;
 
@@ -71,30 +75,29 @@ void MarmotMaterialMechanical::computePlaneStress( double*       stress2D_,
                    dT,
                    pNewDT );
 
-    if ( pNewDT < 1.0 ) {
-      return;
-    }
-
-    double residual = stress3DTemp.array().abs()[2];
-
-    if ( residual < 1.e-10 || ( planeStressCount > 7 && residual < 1e-8 ) ) {
-      break;
-    }
-
-    const double dS33_dF33 = dStress_dDeformationGradient2D( 2, 2, 2 );
-
-    double tangentCompliance = 1. / dS33_dF33;
-    if ( Math::isNaN( tangentCompliance ) || std::abs( tangentCompliance ) > 1e10 )
-      tangentCompliance = 1e10;
-
-    FNew3D( 2, 2 ) -= tangentCompliance * stress3DTemp( 2 );
-
-    planeStressCount += 1;
-    if ( planeStressCount > 13 ) {
-      pNewDT = 0.25;
-      MarmotJournal::warningToMSG( "PlaneStressWrapper requires cutback" );
-      return;
-    }
+    residual( 0 )  = stress3DTemp( 2 );
+    dS33_dF33( 0 ) = dStress_dDeformationGradient3D( 2, 2, 2 );
+
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  Matrix< double, 1, 1 > F33( FNew3D( 2, 2 ) );
+  const auto             result = solve< 1 >( F33,
+                                              evaluate,
+                                              getPlaneStressOptions(),
+                                              planeStressTelemetry,
+                                              typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage planeStressCutback( "PlaneStressWrapper requires cutback",
+                                                           Journal::Severity::Warning );
+    planeStressCutback.report();
+    return;
   }
 
   stress2D = ContinuumMechanics::VoigtNotation::reduce3DVoigt<
@@ -103,14 +106,94 @@ void MarmotMaterialMechanical::computePlaneStress( double*       stress2D_,
     dStress_dDeformationGradient3D );
 }
 
-void MarmotMaterialMechanical::computeUniaxialStress( double*       stress_,
-                                                      double*       dStressDDStrain_,
-                                                      const double* FOld,
-                                                      const double* FNew,
+void MarmotMaterialMechanical::computeUniaxialStress( double*       stress1D_,
+                                                      double*       dStress1D_dF1DNew_,
+                                                      const double* F1DOld_,
+                                                      const double* F1DNew_,
                                                       const double* timeOld,
                                                       const double  dT,
                                                       double&       pNewDT )
 {
+  using namespace Marmot;
+
+  Map< VectorXd > stateVars( this->stateVars, this->nStateVars );
+
+  Vector6d stress3DTemp;
+  VectorXd stateVarsOld = stateVars;
+
+  Matrix3d FNew3D = Matrix3d::Identity();
+  FNew3D( 0, 0 )  = F1DNew_[0];
+
+  Matrix3d FOld3D = Matrix3d::Identity();
+  FOld3D( 0, 0 )  = F1DOld_[0];
+
+  // assumption of isochoric deformation with equal lateral contraction for initial guess
+  Vector2d FLateral = Vector2d::Constant( 1. / std::sqrt( F1DNew_[0] ) );
 
-  throw std::invalid_argument( MakeString() << __PRETTY_FUNCTION__ << "not yet implemented" );
+  EigenTensors::Tensor633d dStress_dDeformationGradient3D;
+
+  auto evaluate = [&]( const Vector2d& FLateral_, Vector2d& residual, Matrix2d& dResidual_dFLateral ) {
+    FNew3D( 1, 1 )    = FLateral_( 0 );
+    FNew3D( 2, 2 )    = FLateral_( 1 );
+    stress3DTemp      = Vector6d::Zero();
+    stress3DTemp( 0 ) = stress1D_[0];
+    stateVars         = stateVarsOld;
+
+    computeStress( stress3DTemp.data(),
+                   dStress_dDeformationGradient3D.data(),
+                   FOld3D.data(),
+                   FNew3D.data(),
+                   timeOld,
+                   dT,
+                   pNewDT );
+
+    residual = stress3DTemp.segment< 2 >( 1 );
+    for ( int i = 0; i < 2; i++ )
+      for ( int j = 0; j < 2; j++ )
+        dResidual_dFLateral( i, j ) = dStress_dDeformationGradient3D( 1 + i, 1 + j, 1 + j );
+
+    return pNewDT >= 1.0;
+  };
+
+  using namespace ContinuumMechanics::Condensation;
+  const auto result = solve< 2 >( FLateral,
+                                  evaluate,
+                                  getUniaxialStressOptions(),
+                                  uniaxialStressTelemetry,
+                                  typeid( *this ).name() );
+
+  if ( result == Result::Aborted )
+    return;
+
+  if ( result == Result::NotConverged ) {
+    pNewDT = 0.25;
+    static Journal::RateLimitedMessage uniaxialStressCutback( "UniaxialStressWrapper requires cutback",
+                                                              Journal::Severity::Warning );
+    uniaxialStressCutback.report();
+    return;
+  }
+
+  // condensation of the lateral deformation gradient components
+  Matrix2d dSLateral_dFLateral;
+  Vector2d dSLateral_dF11, dS11_dFLateral;
+  for ( int i = 0; i < 2; i++ ) {
+    dSLateral_dF11( i ) = dStress_dDeformationGradient3D( 1 + i, 0, 0 );
+    dS11_dFLateral( i ) = dStress_dDeformationGradient3D( 0, 1 + i, 1 + i );
+    for ( int j = 0; j < 2; j++ )
+      dSLateral_dFLateral( i, j ) = dStress_dDeformationGradient3D( 1 + i, 1 + j, 1 + j );
+  }
+
+  stress1D_[0]          = stress3DTemp( 0 );
+  dStress1D_dF1DNew_[0] = dStress_dDeformationGradient3D( 0, 0, 0 ) -
+                          dS11_dFLateral.dot( dSLateral_dFLateral.colPivHouseholderQr().solve( dSLateral_dF11 ) );
+}
+
+const Marmot::ContinuumMechanics::Condensation::Options& MarmotMaterialMechanical::getPlaneStressOptions()
+{
+  return Marmot::ContinuumMechanics::Condensation::defaultPlaneStressOptions;
+}
+
+const Marmot::ContinuumMechanics::Condensation::Options& MarmotMaterialMechanical::getUniaxialStressOptions()
+{
+  return Marmot::ContinuumMechanics::Condensation::defaultUniaxialStressOptions;
 }
@@ -1,5 +1,6 @@
 #include "Marmot/MarmotPronySeries.h"
 #include "Marmot/MarmotTypedefs.h"
+#include <cmath>
 #include <iostream>
 
 namespace Marmot::Materials {
@@ -7,6 +8,132 @@ namespace Marmot::Materials {
 
     using namespace Marmot;
 
+    namespace {
+
+      /**
+       * Coefficients of the exponential algorithm for a term with the relaxation time tau: the decay factor
+       * \f$ e^{-\Delta t/\tau} \f$ of the history, and the factor \f$ \frac{\tau}{\Delta t} ( 1 - e^{-\Delta t/\tau} ) \f$
+       * of the elastic stiffness. As for the general Prony series, terms with a vanishing relaxation time are inactive.
+       */
+      void computeRelaxationCoefficients( const double tau, const double dT, double& decay, double& stiffnessFactor )
+      {
+        if ( tau == 0.0 ) {
+          decay           = 0.0;
+          stiffnessFactor = 0.0;
+        }
+        else if ( dT == 0.0 ) {
+          decay           = 1.0;
+          stiffnessFactor = 1.0;
+        }
+        else {
+          const double oneMinusDecay = -std::expm1( -dT / tau );
+          decay                      = 1.0 - oneMinusDecay;
+          stiffnessFactor            = tau / dT * oneMinusDecay;
+        }
+      }
+
+      /**
+       * Coefficients of the exponential algorithm for a term of the general Prony series: the decay factors
+       * \f$ e^{-\Delta t/\tau_{ij}} \f$ of the history, and the factors \f$ \eta_{ij} ( 1 - e^{-\Delta t/\tau_{ij}} )
+       * / \Delta t \f$ of the strain increment.
+       */
+      void computeTermCoefficients( const Properties& props,
+                                    const size_t      k,
+                                    const double      dT,
+                                    Matrix6d&         decay,
+                                    Matrix6d&         strainFactors )
+      {
+        const auto& tau = props.pronyRelaxationTimes.block< 6, 6 >( 0, k * 6 );
+        const auto& C   = props.pronyStiffnesses.block< 6, 6 >( 0, k * 6 );
+
+        decay = tau.unaryExpr( [dT]( const double& x ) {
+          if ( x != 0.0 )
+            return std::exp( -dT / x );
+          else
+            return 0.0;
+        } );
+
+        strainFactors = ( tau.array() * C.array() * ( 1.0 - decay.array() ) / dT ).matrix();
+      }
+
+      /// Contribution of the strain increment to the state of a term of the general Prony series
+      template < typename Derived >
+      Matrix6d strainIncrementContribution( const MatrixBase< Derived >& strainFactors, const Vector6d& dStrain )
+      {
+        return strainFactors.array().rowwise() * dStrain.transpose().array();
+      }
+
+      Vector6d termStiffnessTimesStrain( const ScalarRelaxationTimeProperties& props,
+                                         const size_t                          k,
+                                         const Vector6d&                       dStrain )
+      {
+        return props.pronyStiffnesses.block< 6, 6 >( 0, k * 6 ) * dStrain;
+      }
+
+      void addTermStiffness( const ScalarRelaxationTimeProperties& props,
+                             const size_t                          k,
+                             const double                          factor,
+                             Matrix6d&                             stiffness )
+      {
+        stiffness += factor * props.pronyStiffnesses.block< 6, 6 >( 0, k * 6 );
+      }
+
+      Vector6d termStiffnessTimesStrain( const IsotropicProperties& props, const size_t k, const Vector6d& dStrain )
+      {
+        const double K = props.pronyBulkModuli( k );
+        const double G = props.pronyShearModuli( k );
+
+        Vector6d result;
+        result.head< 3 >() = ( ( K - 2. / 3 * G ) * dStrain.head< 3 >().sum() + 2 * G * dStrain.head< 3 >().array() );
+        result.tail< 3 >() = G * dStrain.tail< 3 >();
+        return result;
+      }
+
+      void addTermStiffness( const IsotropicProperties& props,
+                             const size_t               k,
+                             const double               factor,
+                             Matrix6d&                  stiffness )
+      {
+        const double K = factor * props.pronyBulkModuli( k );
+        const double G = factor * props.pronyShearModuli( k );
+
+        stiffness.topLeftCorner< 3, 3 >().array() += K - 2. / 3 * G;
+        stiffness.diagonal().head< 3 >().array() += 2 * G;
+        stiffness.diagonal().tail< 3 >().array() += G;
+      }
+
+      /**
+       * Single pass over the terms of a Prony series with scalar relaxation times, in which the state of each term is
+       * its stress. The contributions to the stress and the stiffness are skipped if no stress is given.
+       */
+      template < typename PronyProperties >
+      void evaluateTerms( const PronyProperties&          props,
+                          Vector6d*                       stress,
+                          Matrix6d*                       stiffness,
+                          Eigen::Ref< mapStateVarMatrix > stateVars,
+                          const Vector6d&                 dStrain,
+                          const double                    dT,
+                          const bool                      updateStateVars )
+      {
+        for ( size_t k = 0; k < props.nPronyTerms; k++ ) {
+          double decay, stiffnessFactor;
+          computeRelaxationCoefficients( props.pronyRelaxationTimes( k ), dT, decay, stiffnessFactor );
+
+          const Vector6d dTermStress = stiffnessFactor * termStiffnessTimesStrain( props, k, dStrain ) -
+                                       ( 1.0 - decay ) * stateVars.col( k );
+
+          if ( stress ) {
+            *stress += dTermStress;
+            addTermStiffness( props, k, stiffnessFactor, *stiffness );
+          }
+
+          if ( updateStateVars )
+            stateVars.col( k ) += dTermStress;
+        }
+      }
+
+    } // namespace
+
     void evaluatePronySeries( const Properties&               props,
                               Vector6d&                       stress,
                               Matrix6d&                       stiffness,
@@ -21,32 +148,21 @@ namespace Marmot::Materials {
 
       // prony series terms
       for ( size_t k = 0; k < props.nPronyTerms; k++ ) {
-        const auto& tau       = props.pronyRelaxationTimes.block< 6, 6 >( 0, k * 6 );
-        const auto& C         = props.pronyStiffnesses.block< 6, 6 >( 0, k * 6 );
-        const auto& currState = stateVars.block< 6, 6 >( 0, k * 6 );
+        auto currState = stateVars.block< 6, 6 >( 0, k * 6 );
 
-        const Matrix6d eta = tau.cwiseProduct( C );
-
-        const Matrix6d exp_dt_tau = tau.unaryExpr( [dT]( const double& x ) {
-          if ( x != 0.0 )
-            return std::exp( -dT / x );
-          else
-            return 0.0;
-        } );
+        Matrix6d decay, strainFactors;
+        computeTermCoefficients( props, k, dT, decay, strainFactors );
 
         // due to strain increment
-        stress += ( eta - eta.cwiseProduct( exp_dt_tau ) ) * dStrain / dT;
-        stiffness += ( eta - eta.cwiseProduct( exp_dt_tau ) ) / dT;
+        stress += strainFactors * dStrain;
+        stiffness += strainFactors;
 
         // due to history
-        stress -= Matrix6d( currState - exp_dt_tau.cwiseProduct( currState ) ).colwise().sum();
+        stress -= ( currState - decay.cwiseProduct( currState ) ).rowwise().sum();
 
         // update state variables only if it is requested
         if ( updateStateVars )
-          stateVars.block< 6, 6 >( 0, 6 * k ) = exp_dt_tau.cwiseProduct( currState ) +
-                                                Matrix6d( eta.array().rowwise() * dStrain.transpose().array() / dT ) -
-                                                Matrix6d( eta.array().rowwise() * dStrain.transpose().array() / dT )
-                                                  .cwiseProduct( exp_dt_tau );
+          currState = decay.cwiseProduct( currState ) + strainIncrementContribution( strainFactors, dStrain );
       }
     }
 
@@ -56,25 +172,101 @@ namespace Marmot::Materials {
                           const double                    dT )
     {
       for ( size_t k = 0; k < props.nPronyTerms; k++ ) {
-        const auto& tau       = props.pronyRelaxationTimes.block< 6, 6 >( 0, k * 6 );
-        const auto& C         = props.pronyStiffnesses.block< 6, 6 >( 0, k * 6 );
+        auto currState = stateVars.block< 6, 6 >( 0, k * 6 );
+
+        Matrix6d decay, strainFactors;
+        computeTermCoefficients( props, k, dT, decay, strainFactors );
+
+        currState = decay.cwiseProduct( currState ) + strainIncrementContribution( strainFactors, dStrain );
+      }
+    }
+
+    IncrementPlan planIncrement( const Properties&                        props,
+                                 const Eigen::Ref< const StateVarMatrix >& stateVars,
+                                 const double                              dT )
+    {
+      IncrementPlan plan;
+      plan.stiffness = props.ultimateStiffnessMatrix;
+      plan.historyStress.setZero();
+      plan.decay.resize( 6, 6 * props.nPronyTerms );
+      plan.strainFactors.resize( 6, 6 * props.nPronyTerms );
+
+      for ( size_t k = 0; k < props.nPronyTerms; k++ ) {
+        Matrix6d decay, strainFactors;
+        computeTermCoefficients( props, k, dT, decay, strainFactors );
+
         const auto& currState = stateVars.block< 6, 6 >( 0, k * 6 );
 
-        const Matrix6d eta = tau.cwiseProduct( C );
+        plan.stiffness += strainFactors;
+        plan.historyStress += ( currState - decay.cwiseProduct( currState ) ).rowwise().sum();
+        plan.decay.block< 6, 6 >( 0, k * 6 )         = decay;
+        plan.strainFactors.block< 6, 6 >( 0, k * 6 ) = strainFactors;
+      }
 
-        const Matrix6d exp_dt_tau = tau.unaryExpr( [dT]( const double& x ) {
-          if ( x != 0.0 )
-            return std::exp( -dT / x );
-          else
-            return 0.0;
-        } );
+      return plan;
+    }
 
-        stateVars.block< 6, 6 >( 0, 6 * k ) = exp_dt_tau.cwiseProduct( currState ) +
-                                              Matrix6d( eta.array().rowwise() * dStrain.transpose().array() / dT ) -
-                                              Matrix6d( eta.array().rowwise() * dStrain.transpose().array() / dT )
-                                                .cwiseProduct( exp_dt_tau );
+    void evaluatePronySeries( const IncrementPlan& plan, Vector6d& stress, Matrix6d& stiffness, const Vector6d& dStrain )
+    {
+      stress += plan.stiffness * dStrain - plan.historyStress;
+      stiffness = plan.stiffness;
+    }
+
+    void commitIncrement( const IncrementPlan&            plan,
+                          Eigen::Ref< mapStateVarMatrix > stateVars,
+                          const Vector6d&                 dStrain )
+    {
+      for ( Index k = 0; k < plan.decay.cols() / 6; k++ ) {
+        auto currState = stateVars.block< 6, 6 >( 0, k * 6 );
+
+        currState = plan.decay.block< 6, 6 >( 0, k * 6 ).cwiseProduct( currState ) +
+                    strainIncrementContribution( plan.strainFactors.block< 6, 6 >( 0, k * 6 ), dStrain );
       }
     }
 
+    void evaluatePronySeries( const ScalarRelaxationTimeProperties& props,
+                              Vector6d&                             stress,
+                              Matrix6d&                             stiffness,
+                              Eigen::Ref< mapStateVarMatrix >       stateVars,
+                              const Vector6d&                       dStrain,
+                              const double                          dT,
+                              const bool                            updateStateVars )
+    {
+      stress += props.ultimateStiffnessMatrix * dStrain;
+      stiffness = props.ultimateStiffnessMatrix;
+
+      evaluateTerms( props, &stress, &stiffness, stateVars, dStrain, dT, updateStateVars );
+    }
+
+    void updateStateVars( const ScalarRelaxationTimeProperties& props,
+                          Eigen::Ref< mapStateVarMatrix >       stateVars,
+                          const Vector6d&                       dStrain,
+                          const double                          dT )
+    {
+      evaluateTerms( props, nullptr, nullptr, stateVars, dStrain, dT, true );
+    }
+
+    void evaluatePronySeries( const IsotropicProperties&      props,
+                              Vector6d&                       stress,
+                              Matrix6d&                       stiffness,
+                              Eigen::Ref< mapStateVarMatrix > stateVars,
+                              const Vector6d&                 dStrain,
+                              const double                    dT,
+                              const bool                      updateStateVars )
+    {
+      stress += props.ultimateStiffnessMatrix * dStrain;
+      stiffness = props.ultimateStiffnessMatrix;
+
+      evaluateTerms( props, &stress, &stiffness, stateVars, dStrain, dT, updateStateVars );
+    }
+
+    void updateStateVars( const IsotropicProperties&      props,
+                          Eigen::Ref< mapStateVarMatrix > stateVars,
+                          const Vector6d&                 dStrain,
+                          const double                    dT )
+    {
+      evaluateTerms( props, nullptr, nullptr, stateVars, dStrain, dT, true );
+    }
+
   } // namespace PronySeries
 } // namespace Marmot::Materials
@@ -0,0 +1,138 @@
+#include "Marmot/MarmotRateLimitedJournal.h"
+#include "Marmot/MarmotJournal.h"
+#include <array>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace Marmot::Journal {
+
+  namespace {
+
+    std::atomic< bool >                rateLimiting{ false };
+    std::atomic< RateLimitedMessage* > callSites{ nullptr };
+
+    bool emit( const char* message, const Severity severity )
+    {
+      if ( severity == Severity::Warning )
+        return MarmotJournal::warningToMSG( message );
+      else
+        return MarmotJournal::notificationToMSG( message );
+    }
+
+    /**
+     * Per thread table of suppressed occurrences, open addressing by the address of the call site. Only counts per call
+     * site are needed for the summary, hence a fixed size table is used instead of a ring buffer of messages. If the
+     * table is full, the occurrence is directly added to the (atomic) counter of the call site.
+     */
+    struct ThreadLocalTable {
+      static constexpr int size = 16;
+
+      std::array< RateLimitedMessage*, size > sites{};
+      std::array< std::uint64_t, size >       counts{};
+
+      void record( RateLimitedMessage* site )
+      {
+        const int hash = static_cast< int >( ( reinterpret_cast< std::uintptr_t >( site ) >> 4 ) % size );
+        for ( int probe = 0; probe < size; probe++ ) {
+          const int i = ( hash + probe ) % size;
+          if ( sites[i] == site ) {
+            counts[i]++;
+            return;
+          }
+          if ( !sites[i] ) {
+            sites[i]  = site;
+            counts[i] = 1;
+            return;
+          }
+        }
+        site->addSuppressed( 1 );
+      }
+
+      void flush()
+      {
+        for ( int i = 0; i < size; i++ )
+          if ( sites[i] ) {
+            sites[i]->addSuppressed( counts[i] );
+            sites[i]  = nullptr;
+            counts[i] = 0;
+          }
+      }
+
+      ~ThreadLocalTable() { flush(); }
+    };
+
+    ThreadLocalTable& threadLocalTable()
+    {
+      thread_local ThreadLocalTable table;
+      return table;
+    }
+
+  } // namespace
+
+  RateLimitedMessage::RateLimitedMessage( const char* message, Severity severity )
+    : message( message ), severity( severity ), printedInIncrement( false ), nSuppressed( 0 ), registered( false ),
+      next( nullptr )
+  {
+  }
+
+  bool RateLimitedMessage::report()
+  {
+    if ( !rateLimiting.load( std::memory_order_relaxed ) )
+      return emit( message, severity );
+
+    if ( !printedInIncrement.load( std::memory_order_relaxed ) &&
+         !printedInIncrement.exchange( true, std::memory_order_relaxed ) ) {
+      registerCallSite();
+      return emit( message, severity );
+    }
+
+    threadLocalTable().record( this );
+    return severity == Severity::Notification;
+  }
+
+  void RateLimitedMessage::addSuppressed( const std::uint64_t n )
+  {
+    registerCallSite();
+    nSuppressed.fetch_add( n, std::memory_order_relaxed );
+  }
+
+  void RateLimitedMessage::registerCallSite()
+  {
+    if ( registered.load( std::memory_order_relaxed ) || registered.exchange( true, std::memory_order_relaxed ) )
+      return;
+
+    next = callSites.load( std::memory_order_relaxed );
+    while ( !callSites.compare_exchange_weak( next, this, std::memory_order_release, std::memory_order_relaxed ) )
+      ;
+  }
+
+  void setRateLimiting( const bool enable )
+  {
+    rateLimiting.store( enable, std::memory_order_relaxed );
+  }
+
+  void flushThreadLocalMessages()
+  {
+    threadLocalTable().flush();
+  }
+
+  void printMessageSummary()
+  {
+    flushThreadLocalMessages();
+
+    // identical messages from different call sites (e.g., template instances) are reported together
+    std::map< std::pair< std::string, Severity >, std::uint64_t > suppressed;
+
+    for ( RateLimitedMessage* site = callSites.load( std::memory_order_acquire ); site; site = site->next ) {
+      const std::uint64_t n = site->nSuppressed.exchange( 0, std::memory_order_relaxed );
+      site->printedInIncrement.store( false, std::memory_order_relaxed );
+      if ( n > 0 )
+        suppressed[{ site->message, site->severity }] += n;
+    }
+
+    for ( const auto& [key, n] : suppressed )
+      emit( ( key.first + " (suppressed " + std::to_string( n ) + " further occurrences)" ).c_str(), key.second );
+  }
+
+} // namespace Marmot::Journal
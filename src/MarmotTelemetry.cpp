@@ -0,0 +1,155 @@
+#include "Marmot/MarmotTelemetry.h"
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Marmot::Telemetry {
+
+  const std::array< const char*, nCounters > counterNames = {
+    "substeps",
+    "rejectedSubsteps",
+    "minimumStepSizeHits",
+    "planeStressCalls",
+    "planeStressIterations",
+    "uniaxialStressCalls",
+    "uniaxialStressIterations",
+    "cutbacks",
+  };
+
+  std::atomic< bool > enabled{ false };
+
+  namespace {
+
+    std::mutex                         registryMutex;
+    std::map< std::string, Counters >& registry()
+    {
+      static std::map< std::string, Counters > merged;
+      return merged;
+    }
+
+    /**
+     * Per thread accumulator. The number of material types per thread is small, hence a flat vector with a linear
+     * search by pointer is used; the most recently used entry is checked first.
+     */
+    struct ThreadLocalAccumulator {
+      std::vector< std::pair< const char*, Counters > > entries;
+      size_t                                            lastUsed = 0;
+
+      Counters& get( const char* materialType )
+      {
+        if ( lastUsed < entries.size() && entries[lastUsed].first == materialType )
+          return entries[lastUsed].second;
+
+        for ( lastUsed = 0; lastUsed < entries.size(); lastUsed++ )
+          if ( entries[lastUsed].first == materialType )
+            return entries[lastUsed].second;
+
+        entries.push_back( { materialType, Counters{} } );
+        return entries.back().second;
+      }
+
+      void merge()
+      {
+        if ( entries.empty() )
+          return;
+
+        std::lock_guard< std::mutex > lock( registryMutex );
+        for ( const auto& [materialType, counters] : entries ) {
+          Counters& merged = registry()[materialType];
+          for ( int i = 0; i < nCounters; i++ )
+            merged[i] += counters[i];
+        }
+
+        entries.clear();
+        lastUsed = 0;
+      }
+
+      ~ThreadLocalAccumulator() { merge(); }
+    };
+
+    ThreadLocalAccumulator& threadLocalAccumulator()
+    {
+      thread_local ThreadLocalAccumulator accumulator;
+      return accumulator;
+    }
+
+    /// Write a quoted string; quotes are escaped by doubling (CSV) or by a backslash (JSON)
+    void writeQuoted( std::ostream& out, const std::string& string, const bool json )
+    {
+      out << '"';
+      for ( const char c : string ) {
+        if ( c == '"' )
+          out << ( json ? '\\' : '"' );
+        else if ( json && c == '\\' )
+          out << '\\';
+        out << c;
+      }
+      out << '"';
+    }
+
+  } // namespace
+
+  void enable( const bool enable )
+  {
+    enabled.store( enable, std::memory_order_relaxed );
+  }
+
+  void recordThreadLocal( const char* materialType, const Counter counter, const std::uint64_t n )
+  {
+    threadLocalAccumulator().get( materialType )[static_cast< int >( counter )] += n;
+  }
+
+  void mergeThreadLocalCounters()
+  {
+    threadLocalAccumulator().merge();
+  }
+
+  std::map< std::string, Counters > getMergedCounters()
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+    return registry();
+  }
+
+  void reset()
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+    registry().clear();
+  }
+
+  void writeCSV( std::ostream& out )
+  {
+    const auto merged = getMergedCounters();
+
+    out << "materialType";
+    for ( const char* name : counterNames )
+      out << "," << name;
+    out << "\n";
+
+    for ( const auto& [materialType, counters] : merged ) {
+      writeQuoted( out, materialType, false );
+      for ( const auto value : counters )
+        out << "," << value;
+      out << "\n";
+    }
+  }
+
+  void writeJSON( std::ostream& out )
+  {
+    const auto merged = getMergedCounters();
+
+    out << "{";
+    bool firstMaterial = true;
+    for ( const auto& [materialType, counters] : merged ) {
+      out << ( firstMaterial ? "\n  " : ",\n  " );
+      writeQuoted( out, materialType, true );
+      out << ": {";
+      for ( int i = 0; i < nCounters; i++ )
+        out << ( i == 0 ? " \"" : ", \"" ) << counterNames[i] << "\": " << counters[i];
+      out << " }";
+      firstMaterial = false;
+    }
+    out << "\n}\n";
+  }
+
+} // namespace Marmot::Telemetry
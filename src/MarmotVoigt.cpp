@@ -4,7 +4,9 @@
 #include "Marmot/MarmotMath.h"
 #include "Marmot/MarmotTensor.h"
 #include "Marmot/MarmotTypedefs.h"
+#include <algorithm>
 #include <iostream>
+#include <limits>
 
 using namespace Eigen;
 
@@ -66,35 +68,152 @@ namespace Marmot {
 
     namespace Invariants {
 
+      namespace {
+
+        /// Sort eigenvalues (and the respective eigenvectors) ascending
+        void sortAscending( Vector3d& eigenvalues, Matrix3d* eigenvectors )
+        {
+          const auto compareAndSwap = [&]( int i, int j ) {
+            if ( eigenvalues( j ) < eigenvalues( i ) ) {
+              std::swap( eigenvalues( i ), eigenvalues( j ) );
+              if ( eigenvectors )
+                eigenvectors->col( i ).swap( eigenvectors->col( j ) );
+            }
+          };
+          compareAndSwap( 0, 1 );
+          compareAndSwap( 1, 2 );
+          compareAndSwap( 0, 1 );
+        }
+
+        /**
+         * Eigenvalues and, if requested, eigenvectors of a symmetric 3x3 tensor S in Voigt notation with off diagonal
+         * components without factor; see symmetricEigenDecomposition.
+         */
+        void eigenDecomposition( const Vector6d& S, Vector3d& eigenvalues, Matrix3d* eigenvectors )
+        {
+          const double q  = ( S( 0 ) + S( 1 ) + S( 2 ) ) / 3;
+          const double d0 = S( 0 ) - q;
+          const double d1 = S( 1 ) - q;
+          const double d2 = S( 2 ) - q;
+          const double p  = std::sqrt(
+            ( d0 * d0 + d1 * d1 + d2 * d2 + 2 * ( S( 3 ) * S( 3 ) + S( 4 ) * S( 4 ) + S( 5 ) * S( 5 ) ) ) / 6 );
+
+          // (numerically) a multiple of the identity
+          if ( p == 0 || p <= std::numeric_limits< double >::epsilon() * std::abs( q ) ) {
+            eigenvalues = S.head( 3 );
+            if ( eigenvectors )
+              eigenvectors->setIdentity();
+            sortAscending( eigenvalues, eigenvectors );
+            return;
+          }
+
+          // trigonometric solution of the characteristic polynomial of B = ( S - q I ) / p, with det( B ) = 2 cos( 3 phi )
+          const double b0   = d0 / p;
+          const double b1   = d1 / p;
+          const double b2   = d2 / p;
+          const double b3   = S( 3 ) / p;
+          const double b4   = S( 4 ) / p;
+          const double b5   = S( 5 ) / p;
+          const double detB = b0 * b1 * b2 + 2 * b3 * b4 * b5 - b0 * b5 * b5 - b1 * b4 * b4 - b2 * b3 * b3;
+          const double phi  = std::acos( std::clamp( detB / 2, -1., 1. ) ) / 3;
+
+          const double eMax = q + 2 * p * std::cos( phi );
+          const double eMin = q + 2 * p * std::cos( phi + 2. / 3 * Pi );
+          const double eMid = 3 * q - eMax - eMin;
+
+          // the pair of close eigenvalues is ill conditioned with respect to phi, and is hence refined below
+          if ( !eigenvectors && std::min( eMax - eMid, eMid - eMin ) > 1e-1 * p ) {
+            eigenvalues << eMin, eMid, eMax;
+            return;
+          }
+
+          const Matrix3d A = voigtToStress( S );
+
+          // eigenvector of the isolated eigenvalue as the largest cross product of two columns of A - lambda I
+          const double   lambda   = eMax - eMid >= eMid - eMin ? eMax : eMin;
+          const Matrix3d M        = A - lambda * Matrix3d::Identity();
+          const Vector3d cross[3] = { M.col( 0 ).cross( M.col( 1 ) ),
+                                      M.col( 0 ).cross( M.col( 2 ) ),
+                                      M.col( 1 ).cross( M.col( 2 ) ) };
+          int            largest  = 0;
+          for ( int i = 1; i < 3; i++ )
+            if ( cross[i].squaredNorm() > cross[largest].squaredNorm() )
+              largest = i;
+          const Vector3d v = cross[largest].normalized();
+
+          // orthonormal basis u, w of the complement of v, and a single (exact) Jacobi rotation of the remaining block
+          int smallestComponent;
+          v.cwiseAbs().minCoeff( &smallestComponent );
+          const Vector3d u = v.cross( Vector3d::Unit( smallestComponent ) ).normalized();
+          const Vector3d w = v.cross( u );
+
+          const Vector3d Au  = A * u;
+          const Vector3d Aw  = A * w;
+          const double   aUU = u.dot( Au );
+          const double   aUW = u.dot( Aw );
+          const double   aWW = w.dot( Aw );
+
+          double t = 0;
+          if ( aUW != 0 ) {
+            const double theta = ( aWW - aUU ) / ( 2 * aUW );
+            t = ( theta >= 0 ? 1. : -1. ) / ( std::abs( theta ) + std::sqrt( theta * theta + 1 ) );
+          }
+          const double c  = 1. / std::sqrt( t * t + 1 );
+          const double sn = t * c;
+
+          eigenvalues << v.dot( A * v ), aUU - t * aUW, aWW + t * aUW;
+          if ( eigenvectors ) {
+            eigenvectors->col( 0 ) = v;
+            eigenvectors->col( 1 ) = c * u - sn * w;
+            eigenvectors->col( 2 ) = sn * u + c * w;
+          }
+          sortAscending( eigenvalues, eigenvectors );
+        }
+
+        /// Voigt strain with the off diagonal components without factor
+        Vector6d strainTensorComponents( const Vector6d& voigtStrain )
+        {
+          Vector6d strain = voigtStrain;
+          strain.tail( 3 ) *= 0.5;
+          return strain;
+        }
+
+      } // namespace
+
+      Vector3d symmetricEigenvalues( const Vector6d& voigtStress )
+      {
+        Vector3d eigenvalues;
+        eigenDecomposition( voigtStress, eigenvalues, nullptr );
+        return eigenvalues;
+      }
+
+      std::pair< Vector3d, Matrix3d > symmetricEigenDecomposition( const Vector6d& voigtStress )
+      {
+        Vector3d eigenvalues;
+        Matrix3d eigenvectors;
+        eigenDecomposition( voigtStress, eigenvalues, &eigenvectors );
+        return { eigenvalues, eigenvectors };
+      }
+
       Vector3d principalStrains( const Vector6d& voigtStrain )
       {
-        SelfAdjointEigenSolver< Matrix3d > es( voigtToStrain( voigtStrain ) );
-        return es.eigenvalues();
+        return symmetricEigenvalues( strainTensorComponents( voigtStrain ) );
       }
 
       Vector3d principalStresses( const Vector6d& voigtStress )
       {
-        SelfAdjointEigenSolver< Matrix3d > es( voigtToStress( voigtStress ) );
-        return es.eigenvalues();
+        return symmetricEigenvalues( voigtStress );
       }
 
       Vector3d sortedPrincipalStrains( const Vector6d& voigtStrain )
       {
-        HaighWestergaardCoordinates hw = haighWestergaardFromStrain( voigtStrain );
-        Vector3d                    strainPrinc;
-
-        strainPrinc << hw.xi / sqrt3 + sqrt2_3 * hw.rho * std::cos( hw.theta ),
-          hw.xi / sqrt3 + sqrt2_3 * hw.rho * ( -std::sin( Constants::Pi / 6. - hw.theta ) ),
-          hw.xi / sqrt3 + sqrt2_3 * hw.rho * ( -std::sin( Constants::Pi / 6. + hw.theta ) );
-
-        return strainPrinc;
+        return principalStrains( voigtStrain ).reverse();
       }
 
       Eigen::Matrix3d principalStressesDirections( const Marmot::Vector6d& voigtStress )
       {
-        SelfAdjointEigenSolver< Matrix3d > es( voigtToStress( voigtStress ) );
-        Matrix3d                           Q = es.eigenvectors();
-        Q.col( 2 )                           = Q.col( 0 ).cross( Q.col( 1 ) ); // for a clockwise coordinate system
+        Matrix3d Q = symmetricEigenDecomposition( voigtStress ).second;
+        Q.col( 2 ) = Q.col( 0 ).cross( Q.col( 1 ) ); // for a clockwise coordinate system
         return Q;
       }
 
@@ -250,6 +369,45 @@ namespace Marmot {
     namespace Derivatives {
       using namespace Invariants;
 
+      namespace {
+
+        /**
+         * Derivatives of the eigenvalues (given in ascending order) of a symmetric tensor with respect to its Voigt
+         * components, i.e., the eigenprojections \f$ \boldsymbol{n}_k \otimes \boldsymbol{n}_k \f$ in Voigt
+         * notation with the shear components scaled by shearFactor. Eigenvalues coinciding up to a relative tolerance
+         * form a cluster, and each member of a cluster gets the mean eigenprojection of the cluster. This is the
+         * derivative of the mean eigenvalue of the cluster, which does not depend on the arbitrary choice of the
+         * eigenvectors of a repeated eigenvalue.
+         */
+        Matrix36 principalValueDerivatives( const Vector3d& eigenvalues,
+                                            const Matrix3d& eigenvectors,
+                                            const double    shearFactor )
+        {
+          Matrix36 dE;
+          for ( int k = 0; k < 3; k++ ) {
+            const Vector3d n = eigenvectors.col( k );
+            dE.row( k ) << n( 0 ) * n( 0 ), n( 1 ) * n( 1 ), n( 2 ) * n( 2 ), shearFactor * n( 0 ) * n( 1 ),
+              shearFactor * n( 0 ) * n( 2 ), shearFactor * n( 1 ) * n( 2 );
+          }
+
+          // eigenvectors of eigenvalues closer than the tolerance are not reliable anymore
+          const double tolerance = 1e-8 * eigenvalues.cwiseAbs().maxCoeff();
+
+          int first = 0;
+          for ( int k = 1; k <= 3; k++ )
+            if ( k == 3 || eigenvalues( k ) - eigenvalues( k - 1 ) > tolerance ) {
+              if ( k - first > 1 ) {
+                const RowVector6d mean = dE.middleRows( first, k - first ).colwise().mean();
+                dE.middleRows( first, k - first ).rowwise() = mean;
+              }
+              first = k;
+            }
+
+          return dE;
+        }
+
+      } // namespace
+
       Vector6d dStressMean_dStress()
       {
         return 1. / 3 * I;
@@ -359,24 +517,16 @@ namespace Marmot {
                dThetaStrain_dJ3Strain( strain ) * dJ3Strain_dStrain( strain );
       }
 
-      Matrix36 dStressPrincipals_dStress( const Vector6d& stress ) // derivative when principal stresses are
-                                                                   // computed from solving Eigenvalue-Problem
+      Matrix36 dStressPrincipals_dStress( const Vector6d& stress )
       {
-        MatrixXd J( 3, 6 );
-
-        Vector6d leftX;
-        Vector6d rightX;
-
-        for ( size_t i = 0; i < 6; i++ ) {
-          double volatile h = std::max( 1.0, std::abs( stress( i ) ) ) * Constants::cubicRootEps();
-          leftX             = stress;
-          leftX( i ) -= h;
-          rightX = stress;
-          rightX( i ) += h;
+        const auto [eigenvalues, eigenvectors] = symmetricEigenDecomposition( stress );
+        return principalValueDerivatives( eigenvalues, eigenvectors, 2. );
+      }
 
-          J.col( i ) = 1. / ( 2 * h ) * ( principalStresses( rightX ) - principalStresses( leftX ) );
-        }
-        return J;
+      Matrix36 dStrainPrincipals_dStrain( const Vector6d& strain )
+      {
+        const auto [eigenvalues, eigenvectors] = symmetricEigenDecomposition( strainTensorComponents( strain ) );
+        return principalValueDerivatives( eigenvalues, eigenvectors, 1. );
       }
 
       Vector3d dStrainVolumetricNegative_dStrainPrincipal( const Vector6d& strain )
@@ -400,49 +550,10 @@ namespace Marmot {
         return I.transpose() * ( Matrix6d::Identity() - CelInv * Cep );
       }
 
-      Matrix36 dSortedStrainPrincipal_dStrain(
-        const Vector6d& dEp ) // equations from page 218-219 PhD Thesis David Unteregger
+      Matrix36 dSortedStrainPrincipal_dStrain( const Vector6d& dEp )
       {
-        Vector3d dEpPrinc_dEpvol   = Vector3d::Zero();
-        Vector3d dEpPrinc_dEprho   = Vector3d::Zero();
-        Vector3d dEPprinc_dEptheta = Vector3d::Zero();
-
-        const double                      sqrt2_3 = std::sqrt( 2. / 3. );
-        const HaighWestergaardCoordinates hw      = haighWestergaardFromStrain( dEp );
-        // const double& epsM =		hw(0);
-        const double& rhoE = hw.rho;
-        // const double& thetaE =		hw(2);
-
-        dEpPrinc_dEpvol = 1. / 3. * Vector3d::Ones();
-        dEpPrinc_dEprho << sqrt2_3 * std::cos( hw.theta ), sqrt2_3 * std::cos( hw.theta - 2. * Constants::Pi / 3. ),
-          sqrt2_3 * std::cos( hw.theta + 2. * Constants::Pi / 3. );
-
-        dEPprinc_dEptheta << -sqrt2_3 * hw.rho * std::sin( hw.theta ),
-          -sqrt2_3 * hw.rho * std::sin( hw.theta - 2. * Constants::Pi / 3. ),
-          -sqrt2_3 * hw.rho * std::sin( hw.theta + 2. * Constants::Pi / 3. );
-
-        RowVector6d dEpvol_dEp   = RowVector6d::Zero();
-        dEpvol_dEp               = I;
-        RowVector6d dEprho_dEp   = RowVector6d::Zero();
-        RowVector6d dEptheta_dEp = RowVector6d::Zero();
-
-        if ( std::abs( rhoE ) > 1e-16 ) {
-          dEprho_dEp   = 1. / rhoE * dJ2Strain_dStrain( dEp ).transpose();
-          dEptheta_dEp = ( dThetaStrain_dJ2Strain( dEp ) * dJ2Strain_dStrain( dEp ).transpose() ) +
-                         ( dThetaStrain_dJ3Strain( dEp ) * dJ3Strain_dStrain( dEp ).transpose() );
-        }
-        else {
-          dEprho_dEp << 1.e16, 1.e16, 1.e16, 1.e16, 1.e16,
-            1.e16; // 1e16 from Code David (Line 67,
-                   // D_2_Umatsub_damage3_derivatives)
-          dEptheta_dEp << 0., 0., 0., 0., 0., 0.;
-        }
-
-        Matrix36 dEpPrincdEpAna;
-        dEpPrincdEpAna = ( dEpPrinc_dEpvol * dEpvol_dEp ) + ( dEpPrinc_dEprho * dEprho_dEp ) +
-                         ( dEPprinc_dEptheta * dEptheta_dEp );
-
-        return dEpPrincdEpAna;
+        // sorted descending, i.e., reversed order of the eigen solver
+        return dStrainPrincipals_dStrain( dEp ).colwise().reverse();
       }
 
       RowVector6d dDeltaEpvneg_dE( const Vector6d& dEp, const Matrix6d& CelInv, const Matrix6d& Cep )
@@ -1,5 +1,6 @@
 #include "Marmot/MenetreyWillam.h"
 #include "Marmot/MarmotConstants.h"
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 
@@ -46,6 +47,178 @@ namespace Marmot {
         break;
       default: throw std::invalid_argument( "Requested MenetreyWillamType not found." );
       }
+
+      updatePrecomputedConstants();
+    }
+
+    void MenetreyWillam::setParameters( const MenetreyWillamParameters& parameters )
+    {
+      param = parameters;
+      updatePrecomputedConstants();
+    }
+
+    void MenetreyWillam::updatePrecomputedConstants()
+    {
+      const double e = param.e;
+
+      constants.circular      = e >= 1.0;
+      constants.oneMinusE2    = 1. - e * e;
+      constants.twoEMinusOne  = 2. * e - 1.;
+      constants.twoEMinusOne2 = ( 2. * e - 1. ) * ( 2. * e - 1. );
+      constants.fiveE2Minus4E = 5. * e * e - 4. * e;
+      constants.Af2           = param.Af * param.Af;
+      constants.mBf           = param.m * param.Bf;
+      constants.mCf           = param.m * param.Cf;
+    }
+
+    void MenetreyWillam::yieldFunctionBatch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                                             const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                                             const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                                             Eigen::Ref< Eigen::ArrayXd >              f,
+                                             const double                              varEps ) const
+    {
+      evaluateBatch( xi, rho, theta, varEps, f.data(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr );
+    }
+
+    void MenetreyWillam::dYieldFunction_dHaighWestergaardBatch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                                                                const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                                                                const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                                                                Eigen::Ref< Eigen::ArrayXd >              f,
+                                                                Eigen::Ref< Eigen::ArrayXd >              dF_dXi,
+                                                                Eigen::Ref< Eigen::ArrayXd >              dF_dRho,
+                                                                Eigen::Ref< Eigen::ArrayXd >              dF_dTheta,
+                                                                const double                              varEps ) const
+    {
+      evaluateBatch( xi,
+                     rho,
+                     theta,
+                     varEps,
+                     f.data(),
+                     dF_dXi.data(),
+                     dF_dRho.data(),
+                     dF_dTheta.data(),
+                     nullptr,
+                     nullptr,
+                     nullptr );
+    }
+
+    void MenetreyWillam::d2YieldFunction_dHaighWestergaard2Batch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                                                                  const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                                                                  const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                                                                  Eigen::Ref< Eigen::ArrayXd >              f,
+                                                                  Eigen::Ref< Eigen::ArrayXd >              dF_dXi,
+                                                                  Eigen::Ref< Eigen::ArrayXd >              dF_dRho,
+                                                                  Eigen::Ref< Eigen::ArrayXd >              dF_dTheta,
+                                                                  Eigen::Ref< Eigen::ArrayXd >              d2F_dRho2,
+                                                                  Eigen::Ref< Eigen::ArrayXd > d2F_dRho_dTheta,
+                                                                  Eigen::Ref< Eigen::ArrayXd > d2F_dTheta2,
+                                                                  const double                 varEps ) const
+    {
+      evaluateBatch( xi,
+                     rho,
+                     theta,
+                     varEps,
+                     f.data(),
+                     dF_dXi.data(),
+                     dF_dRho.data(),
+                     dF_dTheta.data(),
+                     d2F_dRho2.data(),
+                     d2F_dRho_dTheta.data(),
+                     d2F_dTheta2.data() );
+    }
+
+    void MenetreyWillam::evaluateBatch( const Eigen::Ref< const Eigen::ArrayXd >& xi,
+                                        const Eigen::Ref< const Eigen::ArrayXd >& rho,
+                                        const Eigen::Ref< const Eigen::ArrayXd >& theta,
+                                        const double                              varEps,
+                                        double*                                   f,
+                                        double*                                   dF_dXi,
+                                        double*                                   dF_dRho,
+                                        double*                                   dF_dTheta,
+                                        double*                                   d2F_dRho2,
+                                        double*                                   d2F_dRho_dTheta,
+                                        double*                                   d2F_dTheta2 ) const
+    {
+      using namespace Eigen;
+
+      // fixed capacity chunks live on the stack and allow for vectorization
+      constexpr Index                                      chunkSize = 64;
+      typedef Array< double, Dynamic, 1, 0, chunkSize, 1 > Chunk;
+      typedef Map< Array< double, Dynamic, 1 > >           Output;
+
+      const bool firstDerivatives  = dF_dRho != nullptr;
+      const bool secondDerivatives = d2F_dRho2 != nullptr;
+
+      const Index n = xi.size();
+      for ( Index start = 0; start < n; start += chunkSize ) {
+        const Index size = std::min( chunkSize, n - start );
+
+        const auto xi_  = xi.segment( start, size );
+        const auto rho_ = rho.segment( start, size );
+
+        Chunk r, dR_dTheta, d2R_dTheta2;
+        if ( constants.circular ) {
+          r.setOnes( size );
+          dR_dTheta.setZero( size );
+          d2R_dTheta2.setZero( size );
+        }
+        else {
+          const auto  theta_   = theta.segment( start, size );
+          const Chunk cosTheta = theta_.cos();
+          // the sine is evaluated directly, as sqrt( 1 - cos^2 ) cancels for small Lode angles
+          Chunk sinTheta;
+          if ( firstDerivatives )
+            sinTheta = theta_.sin();
+          polarRadiusKernel< Chunk >( cosTheta,
+                                      &sinTheta,
+                                      r,
+                                      firstDerivatives ? &dR_dTheta : nullptr,
+                                      secondDerivatives ? &d2R_dTheta2 : nullptr );
+        }
+
+        if ( varEps == 0.0 ) {
+          Output( f + start, size ) = constants.Af2 * rho_ * rho_ + constants.mBf * rho_ * r + constants.mCf * xi_ - 1.;
+          if ( !firstDerivatives )
+            continue;
+
+          Output( dF_dXi + start, size ).setConstant( constants.mCf );
+          Output( dF_dRho + start, size )   = 2. * constants.Af2 * rho_ + constants.mBf * r;
+          Output( dF_dTheta + start, size ) = constants.mBf * rho_ * dR_dTheta;
+          if ( !secondDerivatives )
+            continue;
+
+          Output( d2F_dRho2 + start, size ).setConstant( 2. * constants.Af2 );
+          Output( d2F_dRho_dTheta + start, size ) = constants.mBf * dR_dTheta;
+          Output( d2F_dTheta2 + start, size )     = constants.mBf * rho_ * d2R_dTheta2;
+        }
+        else {
+          // f = Af^2 rho^2 + m ( g + Cf xi ) - 1 with g = sqrt( s^2 + varEps^2 ) and s = Bf rho r
+          const Chunk s = param.Bf * rho_ * r;
+          const Chunk g = ( s * s + varEps * varEps ).sqrt();
+
+          Output( f + start, size ) = constants.Af2 * rho_ * rho_ + param.m * g + constants.mCf * xi_ - 1.;
+          if ( !firstDerivatives )
+            continue;
+
+          const Chunk dG_dS = s / g;
+
+          Output( dF_dXi + start, size ).setConstant( constants.mCf );
+          Output( dF_dRho + start, size )   = 2. * constants.Af2 * rho_ + constants.mBf * dG_dS * r;
+          Output( dF_dTheta + start, size ) = constants.mBf * dG_dS * rho_ * dR_dTheta;
+          if ( !secondDerivatives )
+            continue;
+
+          const Chunk d2G_dS2   = varEps * varEps / ( g * g * g );
+          const Chunk dS_dRho   = param.Bf * r;
+          const Chunk dS_dTheta = param.Bf * rho_ * dR_dTheta;
+
+          Output( d2F_dRho2 + start, size )       = 2. * constants.Af2 + param.m * d2G_dS2 * dS_dRho * dS_dRho;
+          Output( d2F_dRho_dTheta + start, size ) = param.m *
+                                                    ( d2G_dS2 * dS_dRho * dS_dTheta + dG_dS * param.Bf * dR_dTheta );
+          Output( d2F_dTheta2 + start, size ) = param.m * ( d2G_dS2 * dS_dTheta * dS_dTheta +
+                                                            dG_dS * param.Bf * rho_ * d2R_dTheta2 );
+        }
+      }
     }
 
   } // namespace ContinuumMechanics::CommonConstitutiveModels
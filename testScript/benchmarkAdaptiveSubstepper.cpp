@@ -0,0 +1,85 @@
+/*
+ * Micro-benchmark of the cost per substep of AdaptiveSubstepper and AdaptiveSubstepperMarkII for tangent sizes
+ * n = 7 ... 20.
+ *
+ * g++ -O3 -march=native -o benchmarkAdaptiveSubstepper benchmarkAdaptiveSubstepper.cpp -lMarmot
+ */
+#include "Marmot/AdaptiveSubstepper.h"
+#include "Marmot/AdaptiveSubstepperMarkII.h"
+#include "benchmarkUtility.h"
+#include <iostream>
+#include <utility>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace BenchmarkUtility;
+
+/// Integrate a single increment and return the algorithmic tangent, the number of substeps is accumulated
+template < typename Substepper, size_t n >
+Matrix6d integrateIncrement( long& nSubsteps )
+{
+  typedef Matrix< double, n, n >     TangentSizedMatrix;
+  typedef Matrix< double, n - 6, 1 > IntegrationStateVector;
+
+  const Matrix6d           Cel  = Matrix6d::Identity() * 1e4;
+  const TangentSizedMatrix dXdY = TangentSizedMatrix::Identity() * 0.5 + TangentSizedMatrix::Constant( 1e-3 );
+
+  Vector6d               stress;
+  Matrix6d               tangent;
+  IntegrationStateVector state = IntegrationStateVector::Zero();
+
+  Substepper substepper( 0.1, 1e-3, 2.0, 0.5, 1e-3, 1, Cel );
+  substepper.setConvergedProgress( Vector6d::Zero(), state );
+
+  while ( !substepper.isFinished() ) {
+    const double dT = substepper.getNextSubstep();
+    substepper.getConvergedProgress( stress, state );
+    substepper.finishSubstep( stress + Vector6d::Constant( dT ), dXdY, state );
+    nSubsteps++;
+  }
+
+  substepper.getResults( stress, tangent, state );
+  return tangent;
+}
+
+template < typename Substepper, size_t n >
+double nanosecondsPerSubstep( int nIncrements )
+{
+  long         nSubsteps = 0;
+  const double t         = nanosecondsPerCall(
+    [&]( int ) { return integrateIncrement< Substepper, n >( nSubsteps )( 0, 0 ); },
+    nIncrements );
+
+  return t * nIncrements / nSubsteps;
+}
+
+template < size_t... n >
+bool benchmark( std::index_sequence< n... > )
+{
+  using namespace Marmot::NumericalAlgorithms;
+
+  bool passed = true;
+  (
+    [&] {
+      long           nSubsteps = 0;
+      const Matrix6d tangent   = integrateIncrement< AdaptiveSubstepper< n + 7, n + 1 >, n + 7 >( nSubsteps );
+      const Matrix6d tangentMarkII =
+        integrateIncrement< AdaptiveSubstepperMarkII< n + 7, n + 1 >, n + 7 >( nSubsteps );
+      passed &= check( "n = " + std::to_string( n + 7 ) + ", tangent of AdaptiveSubstepperMarkII",
+                       maximumDeviation( tangentMarkII, tangent ),
+                       1e-12 );
+
+      const double tAdaptive = nanosecondsPerSubstep< AdaptiveSubstepper< n + 7, n + 1 >, n + 7 >( 20000 );
+      const double tMarkII   = nanosecondsPerSubstep< AdaptiveSubstepperMarkII< n + 7, n + 1 >, n + 7 >( 20000 );
+      std::cout << "n = " << n + 7 << ": AdaptiveSubstepper " << tAdaptive << " ns/substep, AdaptiveSubstepperMarkII "
+                << tMarkII << " ns/substep, speedup " << tAdaptive / tMarkII << std::endl;
+    }(),
+    ... );
+
+  return passed;
+}
+
+int main( void )
+{
+  return benchmark( std::make_index_sequence< 14 >() ) ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+/*
+ * Number of return mappings of AdaptiveSubstepper with the Richardson and the embedded error estimator for the
+ * relaxation of a Maxwell element under a constant strain rate, integrated by backward Euler substeps.
+ *
+ * g++ -O3 -o benchmarkAdaptiveSubstepperErrorEstimator benchmarkAdaptiveSubstepperErrorEstimator.cpp -lMarmot
+ */
+#include "Marmot/AdaptiveSubstepper.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace Marmot;
+using namespace Eigen;
+
+typedef NumericalAlgorithms::AdaptiveSubstepper< 7, 1 > Substepper;
+
+constexpr double E           = 30000.;
+constexpr double dStrain     = 1e-3;
+constexpr double dTOverTau   = 20.;
+constexpr double tolerance   = 1e-4;
+constexpr int    nIncrements = 10;
+const Matrix6d   Cel         = Matrix6d::Identity() * E;
+
+/// Run the loading history, and return the number of return mappings and the maximum error of the stress
+void run( Substepper::ErrorEstimator errorEstimator, int& nReturnMappings, double& error )
+{
+  Vector6d                           stress = Vector6d::Zero();
+  Matrix6d                           tangent;
+  Substepper::IntegrationStateVector state = Substepper::IntegrationStateVector::Zero();
+  double                             exact = 0;
+
+  nReturnMappings = 0;
+  error           = 0;
+  for ( int i = 0; i < nIncrements; i++ ) {
+    Substepper substepper( 0.1, 1e-6, 10., 0.5, tolerance, 1, Cel, errorEstimator );
+    substepper.setConvergedProgress( stress, state );
+
+    while ( !substepper.isFinished() ) {
+      const double h = substepper.getNextSubstep();
+
+      Vector6d                           stressOld = Vector6d::Zero();
+      Substepper::IntegrationStateVector stateOld  = Substepper::IntegrationStateVector::Zero();
+      substepper.getConvergedProgress( stressOld, stateOld );
+
+      // backward Euler step of the Maxwell element for the fraction h of the increment
+      const double                   relaxation = 1. / ( 1. + h * dTOverTau );
+      Substepper::TangentSizedMatrix dXdY       = Substepper::TangentSizedMatrix::Identity();
+      dXdY.topLeftCorner< 6, 6 >() *= relaxation;
+
+      Vector6d newStress = stressOld;
+      newStress( 0 )     = relaxation * ( stressOld( 0 ) + h * E * dStrain );
+
+      substepper.finishSubstep( newStress, dXdY, stateOld );
+      nReturnMappings++;
+    }
+
+    substepper.getResults( stress, tangent, state );
+    exact = exact * std::exp( -dTOverTau ) + E * dStrain * ( 1. - std::exp( -dTOverTau ) ) / dTOverTau;
+    error = std::max( error, std::abs( stress( 0 ) - exact ) );
+  }
+}
+
+int main( void )
+{
+  for ( const auto errorEstimator : { Substepper::ErrorEstimator::Richardson, Substepper::ErrorEstimator::Embedded } ) {
+    int    nReturnMappings;
+    double error;
+    run( errorEstimator, nReturnMappings, error );
+
+    std::cout << ( errorEstimator == Substepper::ErrorEstimator::Richardson ? "Richardson: " : "embedded:   " )
+              << nReturnMappings << " return mappings, maximum error of the stress " << error << std::endl;
+  }
+
+  return 0;
+}
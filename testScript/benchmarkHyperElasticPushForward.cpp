@@ -0,0 +1,61 @@
+/*
+ * Micro-benchmark of the push forward of the 2nd Piola-Kirchhoff stress and its tangent in
+ * MarmotMaterialHyperElastic, comparing the specialized kernel against the reference tensor implementation.
+ *
+ * g++ -O3 -march=native -o benchmarkHyperElasticPushForward benchmarkHyperElasticPushForward.cpp -lMarmot
+ */
+#include "Marmot/MarmotMaterialHyperElastic.h"
+#include "Marmot/MarmotTypedefs.h"
+#include "benchmarkUtility.h"
+#include <random>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace BenchmarkUtility;
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( -0.1, 0.1 );
+
+  const Matrix3d F    = Matrix3d::Identity() + Matrix3d::NullaryExpr( [&]() { return random( generator ); } );
+  const Vector6d S    = Vector6d::NullaryExpr( [&]() { return 100 * random( generator ); } );
+  Matrix6d       dSdE = Matrix6d::NullaryExpr( [&]() { return 1000 * random( generator ); } );
+  dSdE                = ( dSdE + dSdE.transpose() ).eval();
+
+  const int nRepetitions = 1000000;
+
+  Vector6d               CauchyReference, Cauchy;
+  Matrix< double, 6, 9 > dCauchy_dFReference, dCauchy_dF;
+
+  MarmotMaterialHyperElastic::pushForwardPK2Reference( CauchyReference.data(),
+                                                       dCauchy_dFReference.data(),
+                                                       S.data(),
+                                                       dSdE.data(),
+                                                       F.data() );
+  MarmotMaterialHyperElastic::pushForwardPK2( Cauchy.data(), dCauchy_dF.data(), S.data(), dSdE.data(), F.data() );
+
+  bool passed = true;
+  passed &= check( "Cauchy stress vs. reference", maximumDeviation( Cauchy, CauchyReference ), 1e-13 );
+  passed &= check( "dCauchy_dF vs. reference", maximumDeviation( dCauchy_dF, dCauchy_dFReference ), 1e-13 );
+  if ( !passed )
+    return 1;
+
+  const auto timePushForward = [&]( auto pushForward ) {
+    return nanosecondsPerCall(
+      [&]( int i ) {
+        pushForward( Cauchy.data(), dCauchy_dF.data(), S.data(), dSdE.data(), F.data() );
+        return dCauchy_dF( i % 6, i % 9 );
+      },
+      nRepetitions );
+  };
+
+  const double tReference = timePushForward( MarmotMaterialHyperElastic::pushForwardPK2Reference );
+  const double tOptimized = timePushForward( MarmotMaterialHyperElastic::pushForwardPK2 );
+
+  std::cout << "reference: " << tReference << " ns/call" << std::endl;
+  std::cout << "optimized: " << tOptimized << " ns/call" << std::endl;
+  std::cout << "speedup:   " << tReference / tOptimized << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Benchmark of the fitting time against the accuracy of the Kelvin chain approximations of a compliance function,
+ * comparing the Post-Widder formula of different orders (with and without Gauss quadrature) and the non-negative least
+ * squares fit.
+ *
+ * g++ -O3 -o benchmarkKelvinChainFitting benchmarkKelvinChainFitting.cpp -lMarmot
+ */
+#include "Marmot/MarmotKelvinChain.h"
+#include "benchmarkUtility.h"
+#include <iomanip>
+#include <iostream>
+
+using namespace Marmot::Materials;
+using namespace Eigen;
+using namespace BenchmarkUtility;
+
+// log-power compliance function of the basic creep (B3 type), \phi(t) = q \ln( 1 + ( t / \lambda_0 )^n )
+constexpr double q       = 1.;
+constexpr double n       = 0.1;
+constexpr double lambda0 = 1.;
+
+template < typename T >
+T compliance( T t )
+{
+  using std::log;
+  using std::pow;
+  return q * log( 1. + pow( t / lambda0, n ) );
+}
+
+/// maximum error of the chain compliance relative to the compliance function, sampled within the retardation times
+double maximumError( const KelvinChain::Properties& elasticModuli,
+                     const KelvinChain::Properties& retardationTimes,
+                     double                         zerothCompliance )
+{
+  double error = 0;
+  for ( double t = retardationTimes( 0 ); t <= retardationTimes( retardationTimes.size() - 1 ); t *= 1.1 ) {
+    const double chain = zerothCompliance +
+                         ( ( 1. - ( -t / retardationTimes.array() ).exp() ) / elasticModuli.array() ).sum();
+    error = std::max( error, std::abs( chain - compliance( t ) ) / compliance( t ) );
+  }
+  return error;
+}
+
+/// Time the fit and check the maximum relative error of the fitted chain against the given tolerance
+template < typename Fit >
+bool benchmark( const std::string&             name,
+                Fit                            fit,
+                const KelvinChain::Properties& retardationTimes,
+                double                         tolerance,
+                int                            nRepetitions )
+{
+  KelvinChain::Properties elasticModuli;
+  double                  zerothCompliance = 0;
+
+  const double t = nanosecondsPerCall(
+    [&]( int ) {
+      elasticModuli = fit( zerothCompliance );
+      return elasticModuli( 0 );
+    },
+    nRepetitions );
+
+  std::cout << std::setw( 34 ) << std::left << name << std::setw( 12 ) << t / 1000 << " us/fit" << std::endl;
+  return check( name, maximumError( elasticModuli, retardationTimes, zerothCompliance ), tolerance );
+}
+
+template < int k >
+bool benchmarkPostWidder( const KelvinChain::Properties& retardationTimes, bool gaussQuadrature, int nRepetitions )
+{
+  const auto phi = []( autodiff::Real< k, double > t ) { return compliance( t ); };
+
+  // the Post-Widder approximation is coarse, such that only its order of magnitude is checked
+  return benchmark(
+    "Post-Widder k=" + std::to_string( k ) + ( gaussQuadrature ? ", Gauss" : "" ),
+    [&]( double& zerothCompliance ) {
+      zerothCompliance = KelvinChain::approximateZerothCompliance< k >( phi, retardationTimes( 0 ) );
+      return KelvinChain::computeElasticModuli< k >( phi, retardationTimes, gaussQuadrature );
+    },
+    retardationTimes,
+    0.15,
+    nRepetitions );
+}
+
+int main( void )
+{
+  const KelvinChain::Properties retardationTimes = KelvinChain::generateRetardationTimes( 12, 1e-4, 10. );
+  const int                     nRepetitions     = 200;
+
+  bool passed = true;
+  passed &= benchmarkPostWidder< 2 >( retardationTimes, false, nRepetitions );
+  passed &= benchmarkPostWidder< 2 >( retardationTimes, true, nRepetitions );
+  passed &= benchmarkPostWidder< 3 >( retardationTimes, false, nRepetitions );
+  passed &= benchmarkPostWidder< 3 >( retardationTimes, true, nRepetitions );
+  passed &= benchmarkPostWidder< 5 >( retardationTimes, true, nRepetitions );
+
+  for ( int samplesPerUnit : { 2, 4, 8 } )
+    passed &= benchmark(
+      "least squares, " + std::to_string( samplesPerUnit ) + " samples/unit",
+      [&]( double& zerothCompliance ) {
+        return KelvinChain::fitElasticModuli( compliance< double >,
+                                              retardationTimes,
+                                              zerothCompliance,
+                                              samplesPerUnit );
+      },
+      retardationTimes,
+      5e-3,
+      nRepetitions );
+
+  KelvinChain::FittedChainCache cache;
+  const auto                    fitCached = [&]( double& zerothCompliance ) {
+    const auto& chain = cache.get( { q, n, lambda0 }, retardationTimes, [&]() {
+      KelvinChain::FittedChainCache::Chain chain;
+      chain.elasticModuli = KelvinChain::fitElasticModuli( compliance< double >,
+                                                           retardationTimes,
+                                                           chain.zerothCompliance );
+      return chain;
+    } );
+    zerothCompliance = chain.zerothCompliance;
+    return chain.elasticModuli;
+  };
+  passed &= benchmark( "least squares, cached", fitCached, retardationTimes, 5e-3, nRepetitions );
+
+  // the cache has to return exactly the uncached fit
+  double                        zerothCompliance, zerothComplianceCached;
+  const KelvinChain::Properties elasticModuli =
+    KelvinChain::fitElasticModuli( compliance< double >, retardationTimes, zerothCompliance );
+  const KelvinChain::Properties elasticModuliCached = fitCached( zerothComplianceCached );
+  passed &= check( "cached vs. uncached fit",
+                   std::max( maximumDeviation( elasticModuliCached, elasticModuli ),
+                             std::abs( zerothComplianceCached - zerothCompliance ) ),
+                   0.0 );
+
+  return passed ? 0 : 1;
+}
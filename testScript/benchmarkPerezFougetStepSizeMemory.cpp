@@ -0,0 +1,85 @@
+/*
+ * Number of rejected and total subincrements per increment of the Perez-Fouget substeppers with and without the
+ * substep size memory, for a synthetic material which rejects all subincrements above a critical size. The critical
+ * size changes slowly over the increments, as, e.g., in a softening regime.
+ *
+ * g++ -O3 -o benchmarkPerezFougetStepSizeMemory benchmarkPerezFougetStepSizeMemory.cpp -lMarmot
+ */
+#include "Marmot/PerezFougetSubstepperMarkII.h"
+#include "Marmot/PerezFougetSubstepperTime.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+
+using namespace Marmot;
+using namespace Marmot::NumericalAlgorithms;
+
+constexpr int nIncrements = 1000;
+
+/// critical subincrement size in the given increment, between 0.05 and 0.35
+double criticalStepSize( int increment )
+{
+  return 0.2 + 0.15 * std::sin( 2 * M_PI * increment / 250. );
+}
+
+/// Run one increment, and return the number of rejected subincrements
+template < typename Substepper, typename FinishSubstep >
+int runIncrement( Substepper& substepper, double critical, int& nSubsteps, FinishSubstep&& finishSubstep )
+{
+  while ( !substepper.isFinished() ) {
+    const double h = substepper.getNextSubstep();
+    nSubsteps++;
+
+    if ( h > critical )
+      substepper.decreaseSubstepSize();
+    else
+      finishSubstep( substepper );
+  }
+  return substepper.getNumberOfDecreasedSubsteps();
+}
+
+void report( const std::string& name, bool useMemory, int nRejected, int nSubsteps )
+{
+  std::cout << name << ( useMemory ? " with memory:    " : " without memory: " ) << double( nRejected ) / nIncrements
+            << " rejected and " << double( nSubsteps ) / nIncrements << " total subincrements per increment"
+            << std::endl;
+}
+
+int main( void )
+{
+  const Matrix6d Cel = Matrix6d::Identity();
+
+  for ( const bool useMemory : { false, true } ) {
+    double memory    = 0;
+    int    nRejected = 0, nSubsteps = 0;
+
+    for ( int i = 0; i < nIncrements; i++ ) {
+      PerezFougetSubstepper< 6 > substepper( 1.0, 1e-4, 1.5, 0.5, 2, Cel );
+      if ( useMemory )
+        substepper.enableStepSizeMemory( memory );
+
+      nRejected += runIncrement( substepper, criticalStepSize( i ), nSubsteps, []( auto& s ) {
+        s.finishElasticSubstep();
+      } );
+    }
+    report( "PerezFougetSubstepper    ", useMemory, nRejected, nSubsteps );
+  }
+
+  for ( const bool useMemory : { false, true } ) {
+    double memory    = 0;
+    int    nRejected = 0, nSubsteps = 0;
+
+    for ( int i = 0; i < nIncrements; i++ ) {
+      PerezFougetSubstepperTime< 6 > substepper( 1.0, 1e-4, 1.5, 0.5, 2 );
+      if ( useMemory )
+        substepper.enableStepSizeMemory( memory );
+
+      nRejected += runIncrement( substepper, criticalStepSize( i ), nSubsteps, [&]( auto& s ) {
+        s.extendConsistentTangent( Cel );
+      } );
+    }
+    report( "PerezFougetSubstepperTime", useMemory, nRejected, nSubsteps );
+  }
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * Micro-benchmark of the principal values and directions of a Voigt stress vector, comparing the closed form solver
+ * used by the Invariants helpers against Eigen's iterative SelfAdjointEigenSolver.
+ *
+ * g++ -O3 -o benchmarkPrincipalValues benchmarkPrincipalValues.cpp -lMarmot
+ */
+#include "Marmot/MarmotTypedefs.h"
+#include "Marmot/MarmotVoigt.h"
+#include "benchmarkUtility.h"
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace Marmot::ContinuumMechanics::VoigtNotation;
+using namespace BenchmarkUtility;
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( -100, 100 );
+
+  // every fourth stress state is on a meridian, i.e., it has two repeated principal stresses
+  std::vector< Vector6d > stresses( 1024 );
+  for ( size_t i = 0; i < stresses.size(); i++ ) {
+    stresses[i] = Vector6d::NullaryExpr( [&]() { return random( generator ); } );
+    if ( i % 4 == 0 ) {
+      stresses[i].tail( 3 ).setZero();
+      stresses[i]( 1 ) = stresses[i]( 0 );
+    }
+  }
+
+  const int nRepetitions = 1000000;
+
+  const auto eigenValues = [&]( int i ) {
+    SelfAdjointEigenSolver< Matrix3d > es( voigtToStress( stresses[i % stresses.size()] ), EigenvaluesOnly );
+    return es.eigenvalues()( 0 );
+  };
+  const auto closedFormValues = [&]( int i ) {
+    return Invariants::principalStresses( stresses[i % stresses.size()] )( 0 );
+  };
+  const auto eigenDirections = [&]( int i ) {
+    SelfAdjointEigenSolver< Matrix3d > es( voigtToStress( stresses[i % stresses.size()] ) );
+    return es.eigenvectors()( 0, 0 ) * es.eigenvectors()( 0, 0 );
+  };
+  const auto closedFormDirections = [&]( int i ) {
+    const Matrix3d Q = Invariants::principalStressesDirections( stresses[i % stresses.size()] );
+    return Q( 0, 0 ) * Q( 0, 0 );
+  };
+
+  // the benchmarked paths have to agree, see also checkPrincipalValues.cpp
+  double valueDeviation = 0;
+  for ( const Vector6d& stress : stresses ) {
+    SelfAdjointEigenSolver< Matrix3d > es( voigtToStress( stress ), EigenvaluesOnly );
+    valueDeviation = std::max( valueDeviation,
+                               ( Invariants::principalStresses( stress ) - es.eigenvalues() ).cwiseAbs().maxCoeff() /
+                                 stress.norm() );
+  }
+  if ( !check( "principal values vs. SelfAdjointEigenSolver", valueDeviation, 1e-14 ) )
+    return 1;
+
+  const double tEigenValues          = nanosecondsPerCall( eigenValues, nRepetitions );
+  const double tClosedFormValues     = nanosecondsPerCall( closedFormValues, nRepetitions );
+  const double tEigenDirections      = nanosecondsPerCall( eigenDirections, nRepetitions );
+  const double tClosedFormDirections = nanosecondsPerCall( closedFormDirections, nRepetitions );
+
+  std::cout << "principal values,     SelfAdjointEigenSolver: " << tEigenValues << " ns/call" << std::endl;
+  std::cout << "principal values,     closed form:            " << tClosedFormValues << " ns/call" << std::endl;
+  std::cout << "principal directions, SelfAdjointEigenSolver: " << tEigenDirections << " ns/call" << std::endl;
+  std::cout << "principal directions, closed form:            " << tClosedFormDirections << " ns/call" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * Micro-benchmark of a Prony series step (stress, tangent and state update), comparing the general kernel with 6x6
+ * relaxation times per term against the kernels for scalar relaxation times and for isotropic terms. Moreover, an
+ * implicit step with several Newton iterations is compared with and without an increment plan.
+ *
+ * g++ -O3 -o benchmarkPronySeries benchmarkPronySeries.cpp -lMarmot
+ */
+#include "Marmot/MarmotPronySeries.h"
+#include "benchmarkUtility.h"
+#include <algorithm>
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::Materials::PronySeries;
+using namespace BenchmarkUtility;
+
+Matrix6d isotropicStiffness( double K, double G )
+{
+  Matrix6d C                        = Matrix6d::Zero();
+  C.topLeftCorner< 3, 3 >().array() = K - 2. / 3 * G;
+  C.diagonal().head< 3 >().array() += 2 * G;
+  C.diagonal().tail< 3 >().array() += G;
+  return C;
+}
+
+/// Explicit step i, i.e., a single evaluation with state update
+template < typename PronyProperties >
+void explicitStep( const PronyProperties& props,
+                   StateVarMatrix&        stateVars,
+                   int                    i,
+                   Vector6d&              stress,
+                   Matrix6d&              stiffness )
+{
+  mapStateVarMatrix stateVarsMap( stateVars.data(), 6, stateVars.cols() );
+  const Vector6d    dStrain = Vector6d::Constant( 1e-6 * ( i % 7 - 3 ) );
+  stress.setZero();
+  evaluatePronySeries( props, stress, stiffness, stateVarsMap, dStrain, 1e-2, true );
+}
+
+/// Implicit step i with nIterations evaluations of trial strain increments, the converged one is committed
+template < bool usePlan >
+void implicitStep( const Properties& props,
+                   StateVarMatrix&   stateVars,
+                   int               nIterations,
+                   int               i,
+                   Vector6d&         stress,
+                   Matrix6d&         stiffness )
+{
+  mapStateVarMatrix stateVarsMap( stateVars.data(), 6, stateVars.cols() );
+  const Vector6d    dStrain = Vector6d::Constant( 1e-6 * ( i % 7 - 3 ) );
+  const double      dT      = 1e-2;
+
+  if constexpr ( usePlan ) {
+    const IncrementPlan plan = planIncrement( props, stateVars, dT );
+    for ( int j = 0; j < nIterations; j++ ) {
+      stress.setZero();
+      evaluatePronySeries( plan, stress, stiffness, dStrain * ( j + 1 ) / nIterations );
+    }
+    commitIncrement( plan, stateVarsMap, dStrain );
+  }
+  else {
+    for ( int j = 0; j < nIterations; j++ ) {
+      stress.setZero();
+      evaluatePronySeries( props, stress, stiffness, stateVarsMap, dStrain * ( j + 1 ) / nIterations, dT );
+    }
+    updateStateVars( props, stateVarsMap, dStrain, dT );
+  }
+}
+
+/// Maximum deviation of the stresses and stiffnesses of two step sequences, each starting from a vanishing state
+template < typename StepA, typename StepB >
+double maximumDeviationOfSteps( StepA stepA, StepB stepB, int nSteps )
+{
+  double deviation = 0;
+  for ( int i = 0; i < nSteps; i++ ) {
+    Vector6d stressA, stressB;
+    Matrix6d stiffnessA, stiffnessB;
+    stepA( i, stressA, stiffnessA );
+    stepB( i, stressB, stiffnessB );
+    deviation = std::max( { deviation,
+                            maximumDeviation( stressA, stressB ),
+                            maximumDeviation( stiffnessA, stiffnessB ) } );
+  }
+  return deviation;
+}
+
+/// Mean time per step of a step sequence in nanoseconds
+template < typename Step >
+double benchmark( Step step, int nRepetitions )
+{
+  return nanosecondsPerCall(
+    [&]( int i ) {
+      Vector6d stress;
+      Matrix6d stiffness;
+      step( i, stress, stiffness );
+      return stress( 0 ) + stiffness( 0, 0 );
+    },
+    nRepetitions );
+}
+
+int main( void )
+{
+  const int nTerms       = 8;
+  const int nRepetitions = 1000000;
+
+  Properties                     general;
+  ScalarRelaxationTimeProperties scalar;
+  IsotropicProperties            isotropic;
+
+  general.nPronyTerms = scalar.nPronyTerms = isotropic.nPronyTerms = nTerms;
+  general.ultimateStiffnessMatrix = scalar.ultimateStiffnessMatrix = isotropic.ultimateStiffnessMatrix =
+    isotropicStiffness( 1000, 500 );
+
+  general.pronyStiffnesses.resize( 6, 6 * nTerms );
+  general.pronyRelaxationTimes.resize( 6, 6 * nTerms );
+  scalar.pronyStiffnesses.resize( 6, 6 * nTerms );
+  scalar.pronyRelaxationTimes.resize( nTerms );
+  isotropic.pronyBulkModuli.resize( nTerms );
+  isotropic.pronyShearModuli.resize( nTerms );
+  isotropic.pronyRelaxationTimes.resize( nTerms );
+
+  for ( int k = 0; k < nTerms; k++ ) {
+    const double K = 100. / ( k + 1 ), G = 50. / ( k + 1 ), tau = std::pow( 10., k - 3 );
+
+    general.pronyStiffnesses.block< 6, 6 >( 0, 6 * k ) = isotropicStiffness( K, G );
+    general.pronyRelaxationTimes.block< 6, 6 >( 0, 6 * k ).setConstant( tau );
+    scalar.pronyStiffnesses.block< 6, 6 >( 0, 6 * k ) = isotropicStiffness( K, G );
+    scalar.pronyRelaxationTimes( k )                  = tau;
+    isotropic.pronyBulkModuli( k )                    = K;
+    isotropic.pronyShearModuli( k )                   = G;
+    isotropic.pronyRelaxationTimes( k )               = tau;
+  }
+
+  const int nIterations = 4;
+
+  // every call creates the steps of an independent run starting from a vanishing state
+  const auto explicitSteps = [&]( const auto& props, int nStateColumns ) {
+    StateVarMatrix stateVars = StateVarMatrix::Zero( 6, nStateColumns );
+    return [&props, stateVars]( int i, Vector6d& stress, Matrix6d& stiffness ) mutable {
+      explicitStep( props, stateVars, i, stress, stiffness );
+    };
+  };
+  const auto implicitSteps = [&]( auto usePlan ) {
+    StateVarMatrix stateVars = StateVarMatrix::Zero( 6, 6 * nTerms );
+    return [&, stateVars]( int i, Vector6d& stress, Matrix6d& stiffness ) mutable {
+      implicitStep< decltype( usePlan )::value >( general, stateVars, nIterations, i, stress, stiffness );
+    };
+  };
+
+  bool passed = true;
+  passed &= check( "scalar relaxation times vs. general",
+                   maximumDeviationOfSteps( explicitSteps( scalar, nTerms ),
+                                            explicitSteps( general, 6 * nTerms ),
+                                            100 ),
+                   1e-12 );
+  passed &= check( "isotropic terms vs. general",
+                   maximumDeviationOfSteps( explicitSteps( isotropic, nTerms ),
+                                            explicitSteps( general, 6 * nTerms ),
+                                            100 ),
+                   1e-12 );
+  passed &= check( "implicit with plan vs. without",
+                   maximumDeviationOfSteps( implicitSteps( std::true_type() ),
+                                            implicitSteps( std::false_type() ),
+                                            100 ),
+                   1e-12 );
+  if ( !passed )
+    return 1;
+
+  const double tGeneral          = benchmark( explicitSteps( general, 6 * nTerms ), nRepetitions );
+  const double tScalar           = benchmark( explicitSteps( scalar, nTerms ), nRepetitions );
+  const double tIsotropic        = benchmark( explicitSteps( isotropic, nTerms ), nRepetitions );
+  const double tImplicit         = benchmark( implicitSteps( std::false_type() ), nRepetitions / 10 );
+  const double tImplicitWithPlan = benchmark( implicitSteps( std::true_type() ), nRepetitions / 10 );
+
+  std::cout << "general 6x6 relaxation times: " << tGeneral << " ns/step" << std::endl;
+  std::cout << "scalar relaxation times:      " << tScalar << " ns/step" << std::endl;
+  std::cout << "isotropic terms:              " << tIsotropic << " ns/step" << std::endl;
+  std::cout << "implicit, " << nIterations << " iterations:       " << tImplicit << " ns/step" << std::endl;
+  std::cout << "implicit, " << nIterations << " iterations, plan: " << tImplicitWithPlan << " ns/step" << std::endl;
+
+  return 0;
+}
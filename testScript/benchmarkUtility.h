@@ -0,0 +1,48 @@
+/*
+ * Helpers shared by the benchmarks and checks in this directory: timing of a kernel and reporting of result checks.
+ */
+#pragma once
+#include <Eigen/Core>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+namespace BenchmarkUtility {
+
+  /**
+   * Time nRepetitions calls kernel( i ) and return the mean time per call in nanoseconds. The kernel returns a double,
+   * which is accumulated such that the compiler cannot eliminate the calls.
+   */
+  template < typename Kernel >
+  double nanosecondsPerCall( Kernel&& kernel, int nRepetitions )
+  {
+    double checksum = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for ( int i = 0; i < nRepetitions; i++ )
+      checksum += kernel( i );
+    const auto end = std::chrono::steady_clock::now();
+
+    volatile double sink = checksum;
+    (void)sink;
+
+    return std::chrono::duration< double, std::nano >( end - start ).count() / nRepetitions;
+  }
+
+  /// Maximum deviation of a from the reference b, relative to the magnitude of b or absolute for magnitudes below 1
+  template < typename DerivedA, typename DerivedB >
+  double maximumDeviation( const Eigen::DenseBase< DerivedA >& a, const Eigen::DenseBase< DerivedB >& b )
+  {
+    return ( ( a.derived().array() - b.derived().array() ).abs() / b.derived().array().abs().max( 1.0 ) ).maxCoeff();
+  }
+
+  /// Print the outcome of a result check and return true if it passed; NaN deviations fail
+  inline bool check( const std::string& name, double deviation, double tolerance )
+  {
+    const bool passed = deviation <= tolerance;
+    std::cout << "check " << name << ": maximum deviation " << deviation << ( passed ? " passed" : " FAILED" )
+              << std::endl;
+    return passed;
+  }
+
+} // namespace BenchmarkUtility
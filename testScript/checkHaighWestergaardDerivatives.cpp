@@ -0,0 +1,179 @@
+/*
+ * Check of haighWestergaardAndDerivatives against haighWestergaard and the respective functions in
+ * VoigtNotation::Derivatives for random stresses, stresses with a vanishing deviator and stresses on the tensile and
+ * compressive meridians. The second derivatives are checked against central differences of the first derivatives, and
+ * all derivatives against an instantiation with autodiff::dual.
+ *
+ * g++ -o checkHaighWestergaardDerivatives checkHaighWestergaardDerivatives.cpp -lMarmot
+ */
+#include "Marmot/HaighWestergaard.h"
+#include "autodiff/forward/dual.hpp"
+#include "benchmarkUtility.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace Marmot::ContinuumMechanics::HaighWestergaard;
+using namespace Marmot::ContinuumMechanics::VoigtNotation;
+using namespace BenchmarkUtility;
+
+/// Maximum deviation of a from the reference b, relative to the largest magnitude in b
+template < typename DerivedA, typename DerivedB >
+double deviationRelativeToMaximum( const MatrixBase< DerivedA >& a, const MatrixBase< DerivedB >& b )
+{
+  return ( a - b ).cwiseAbs().maxCoeff() / std::max( b.cwiseAbs().maxCoeff(), 1e-300 );
+}
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( -100, 100 );
+  std::uniform_int_distribution< int >     randomInteger( -100, 100 );
+
+  std::vector< Vector6d > stresses;
+  for ( int i = 0; i < 1000; i++ )
+    stresses.push_back( Vector6d::NullaryExpr( [&]() { return random( generator ); } ) );
+
+  // comparison with haighWestergaard and VoigtNotation::Derivatives
+  double coordinateDeviation = 0, dXiDeviation = 0, dRhoDeviation = 0, dThetaDeviation = 0;
+  for ( const Vector6d& stress : stresses ) {
+    const auto hwd = haighWestergaardAndDerivatives( stress, true );
+    const auto hw  = haighWestergaard( stress );
+
+    const Vector6d dXi_dStress    = Constants::sqrt3 * Derivatives::dStressMean_dStress();
+    const Vector6d dRho_dStress   = Derivatives::dRho_dStress( hw.rho, stress );
+    const Vector6d dTheta_dStress = Derivatives::dTheta_dStress( hw.theta, stress );
+
+    coordinateDeviation = std::max( coordinateDeviation,
+                                    maximumDeviation( Vector3d( hwd.hw.xi, hwd.hw.rho, hwd.hw.theta ),
+                                                      Vector3d( hw.xi, hw.rho, hw.theta ) ) );
+    dXiDeviation        = std::max( dXiDeviation, deviationRelativeToMaximum( hwd.dXi_dStress, dXi_dStress ) );
+    dRhoDeviation       = std::max( dRhoDeviation, deviationRelativeToMaximum( hwd.dRho_dStress, dRho_dStress ) );
+    dThetaDeviation     = std::max( dThetaDeviation, deviationRelativeToMaximum( hwd.dTheta_dStress, dTheta_dStress ) );
+  }
+
+  // second derivatives against central differences of the first derivatives
+  double d2RhoDeviation = 0, d2ThetaDeviation = 0;
+  for ( const Vector6d& stress : stresses ) {
+    const auto   hwd = haighWestergaardAndDerivatives( stress, true );
+    const double h   = 1e-4;
+
+    Matrix6d d2Rho_dStress2Numerical, d2Theta_dStress2Numerical;
+    for ( int j = 0; j < 6; j++ ) {
+      Vector6d stressPlus = stress, stressMinus = stress;
+      stressPlus( j ) += h;
+      stressMinus( j ) -= h;
+      const auto hwdPlus  = haighWestergaardAndDerivatives( stressPlus );
+      const auto hwdMinus = haighWestergaardAndDerivatives( stressMinus );
+
+      d2Rho_dStress2Numerical.col( j )   = ( hwdPlus.dRho_dStress - hwdMinus.dRho_dStress ) / ( 2 * h );
+      d2Theta_dStress2Numerical.col( j ) = ( hwdPlus.dTheta_dStress - hwdMinus.dTheta_dStress ) / ( 2 * h );
+    }
+
+    d2RhoDeviation   = std::max( d2RhoDeviation,
+                               deviationRelativeToMaximum( hwd.d2Rho_dStress2, d2Rho_dStress2Numerical ) );
+    d2ThetaDeviation = std::max( d2ThetaDeviation,
+                                 deviationRelativeToMaximum( hwd.d2Theta_dStress2, d2Theta_dStress2Numerical ) );
+  }
+
+  // first and second derivatives against forward mode automatic differentiation, one direction at a time
+  double autodiffDeviation = 0;
+  for ( size_t i = 0; i < 100; i++ ) {
+    const auto hwd = haighWestergaardAndDerivatives( stresses[i], true );
+
+    Vector3d coordinates( hwd.hw.xi, hwd.hw.rho, hwd.hw.theta ), coordinatesAD;
+    Matrix< double, 3, 6 > dCoordinates_dStress, dCoordinates_dStressAD;
+    dCoordinates_dStress << hwd.dXi_dStress.transpose(), hwd.dRho_dStress.transpose(), hwd.dTheta_dStress.transpose();
+    Matrix6d d2Rho_dStress2AD, d2Theta_dStress2AD;
+
+    for ( int j = 0; j < 6; j++ ) {
+      Matrix< autodiff::dual, 6, 1 > stressAD = stresses[i].cast< autodiff::dual >();
+      stressAD( j ).grad                      = 1;
+      const auto hwdAD                        = haighWestergaardAndDerivatives( stressAD, true );
+
+      coordinatesAD << hwdAD.hw.xi.val, hwdAD.hw.rho.val, hwdAD.hw.theta.val;
+      dCoordinates_dStressAD.col( j ) << hwdAD.hw.xi.grad, hwdAD.hw.rho.grad, hwdAD.hw.theta.grad;
+      for ( int k = 0; k < 6; k++ ) {
+        d2Rho_dStress2AD( k, j )   = hwdAD.dRho_dStress( k ).grad;
+        d2Theta_dStress2AD( k, j ) = hwdAD.dTheta_dStress( k ).grad;
+      }
+    }
+
+    autodiffDeviation = std::max( { autodiffDeviation,
+                                    maximumDeviation( coordinatesAD, coordinates ),
+                                    deviationRelativeToMaximum( dCoordinates_dStressAD, dCoordinates_dStress ),
+                                    deviationRelativeToMaximum( d2Rho_dStress2AD, hwd.d2Rho_dStress2 ),
+                                    deviationRelativeToMaximum( d2Theta_dStress2AD, hwd.d2Theta_dStress2 ) } );
+  }
+
+  // vanishing deviator: hydrostatic stresses, which are exactly representable, and perturbations below 1e-16
+  double vanishingDeviatorDeviation = 0;
+  for ( int i = 0; i < 100; i++ ) {
+    Vector6d stress = Vector6d::Zero();
+    stress.head( 3 ).setConstant( randomInteger( generator ) );
+    if ( i % 2 )
+      stress( 3 + i % 3 ) = 1e-18;
+
+    const auto hwd = haighWestergaardAndDerivatives( stress, true );
+    const auto hw  = haighWestergaard( stress );
+
+    vanishingDeviatorDeviation = std::max( { vanishingDeviatorDeviation,
+                                             std::abs( hwd.hw.xi - hw.xi ),
+                                             std::abs( hwd.hw.rho - hw.rho ),
+                                             std::abs( hwd.hw.theta ),
+                                             hwd.dRho_dStress.cwiseAbs().maxCoeff(),
+                                             hwd.dTheta_dStress.cwiseAbs().maxCoeff(),
+                                             hwd.d2Rho_dStress2.cwiseAbs().maxCoeff(),
+                                             hwd.d2Theta_dStress2.cwiseAbs().maxCoeff(),
+                                             Derivatives::dRho_dStress( hw.rho, stress ).cwiseAbs().maxCoeff() } );
+  }
+
+  // meridians: axisymmetric stresses with well separated principal stresses, for which the Lode angle is 0 or pi/3 up
+  // to the rounding amplified by acos; where it is exactly 0 or pi/3, the derivatives of theta must vanish, while those
+  // of rho are regular
+  double meridianDeviation        = 0;
+  int    nTensileMeridianHits     = 0;
+  int    nCompressiveMeridianHits = 0;
+  for ( int i = 0; i < 1000; i++ ) {
+    const double a = random( generator ), b = random( generator );
+    if ( std::abs( a - b ) < 10 )
+      continue;
+    Vector6d stress = Vector6d::Zero();
+    stress.head( 3 ) << a, b, b;
+
+    const auto   hwd   = haighWestergaardAndDerivatives( stress, true );
+    const auto   hw    = haighWestergaard( stress );
+    const double theta = a > b ? 0 : Constants::Pi / 3;
+
+    meridianDeviation = std::max( { meridianDeviation,
+                                    std::abs( hwd.hw.theta - theta ),
+                                    deviationRelativeToMaximum( hwd.dRho_dStress,
+                                                                Derivatives::dRho_dStress( hw.rho, stress ) ) } );
+
+    if ( hwd.hw.theta != 0 && hwd.hw.theta != Constants::Pi / 3 )
+      continue;
+
+    ( hwd.hw.theta == 0 ? nTensileMeridianHits : nCompressiveMeridianHits )++;
+    meridianDeviation = std::max( { meridianDeviation,
+                                    hwd.dTheta_dStress.cwiseAbs().maxCoeff(),
+                                    hwd.d2Theta_dStress2.cwiseAbs().maxCoeff() } );
+  }
+
+  bool passed = true;
+  passed &= check( "xi, rho, theta vs. haighWestergaard", coordinateDeviation, 1e-13 );
+  passed &= check( "dXi_dStress vs. dStressMean_dStress", dXiDeviation, 1e-15 );
+  passed &= check( "dRho_dStress vs. Derivatives::dRho_dStress", dRhoDeviation, 1e-13 );
+  passed &= check( "dTheta_dStress vs. Derivatives::dTheta_dStress", dThetaDeviation, 1e-8 );
+  passed &= check( "d2Rho_dStress2 vs. central differences", d2RhoDeviation, 1e-6 );
+  passed &= check( "d2Theta_dStress2 vs. central differences", d2ThetaDeviation, 1e-6 );
+  passed &= check( "derivatives vs. autodiff::dual", autodiffDeviation, 1e-12 );
+  passed &= check( "vanishing deviator", vanishingDeviatorDeviation, 1e-15 );
+  passed &= check( "meridians", meridianDeviation, 1e-6 );
+  passed &= check( "missing hits of the tensile and compressive meridian branches",
+                   ( nTensileMeridianHits == 0 ) + ( nCompressiveMeridianHits == 0 ),
+                   0 );
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+/*
+ * Check that HughesWingetBatch gives bit-identical results to the scalar HughesWinget for each lane, for random
+ * deformation gradients and stresses.
+ *
+ * The check requires that the compiler does not contract floating point operations differently in the scalar and the
+ * vectorized code, hence it is compiled with -ffp-contract=off:
+ *
+ * g++ -ffp-contract=off -o checkHughesWingetBatch checkHughesWingetBatch.cpp -lMarmot
+ */
+#include "Marmot/HughesWinget.h"
+#include <cstring>
+#include <iostream>
+#include <random>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace Marmot::NumericalAlgorithms;
+
+template < int nLanes >
+bool check( std::mt19937& generator, int nBatches )
+{
+  std::uniform_real_distribution< double > random( -0.2, 0.2 );
+
+  int nMismatches = 0;
+  for ( int batch = 0; batch < nBatches; batch++ ) {
+    Matrix3d FOld[nLanes], FNew[nLanes];
+    Vector6d stress[nLanes];
+    double   FOldLanes[9 * nLanes], FNewLanes[9 * nLanes], stressLanes[6 * nLanes];
+
+    for ( int p = 0; p < nLanes; p++ ) {
+      FOld[p]   = Matrix3d::Identity() + Matrix3d::NullaryExpr( [&]() { return random( generator ); } );
+      FNew[p]   = FOld[p] + 0.1 * Matrix3d::NullaryExpr( [&]() { return random( generator ); } );
+      stress[p] = Vector6d::NullaryExpr( [&]() { return 1000 * random( generator ); } );
+
+      for ( int i = 0; i < 9; i++ ) {
+        FOldLanes[i * nLanes + p] = FOld[p].data()[i];
+        FNewLanes[i * nLanes + p] = FNew[p].data()[i];
+      }
+      for ( int i = 0; i < 6; i++ )
+        stressLanes[i * nLanes + p] = stress[p]( i );
+    }
+
+    HughesWingetBatch< nLanes > hughesWingetBatch( FOldLanes, FNewLanes, HughesWinget::Formulation::AbaqusLike );
+
+    double dEpsLanes[6 * nLanes], dOmegaLanes[9 * nLanes];
+    hughesWingetBatch.getStrainIncrements( dEpsLanes );
+    hughesWingetBatch.getRotationIncrements( dOmegaLanes );
+    hughesWingetBatch.rotateTensors( stressLanes );
+
+    for ( int p = 0; p < nLanes; p++ ) {
+      HughesWinget hughesWinget( FOld[p], FNew[p], HughesWinget::Formulation::AbaqusLike );
+
+      const Vector6d dEps    = hughesWinget.getStrainIncrement();
+      const Matrix3d dOmega  = hughesWinget.getRotationIncrement();
+      const Vector6d rotated = hughesWinget.rotateTensor( stress[p] );
+
+      for ( int i = 0; i < 9; i++ ) {
+        // bitwise comparison, which also distinguishes signed zeros
+        if ( i < 6 && std::memcmp( &dEps( i ), &dEpsLanes[i * nLanes + p], sizeof( double ) ) != 0 )
+          nMismatches++;
+        if ( i < 6 && std::memcmp( &rotated( i ), &stressLanes[i * nLanes + p], sizeof( double ) ) != 0 )
+          nMismatches++;
+        if ( std::memcmp( &dOmega.data()[i], &dOmegaLanes[i * nLanes + p], sizeof( double ) ) != 0 )
+          nMismatches++;
+      }
+    }
+  }
+
+  std::cout << "nLanes=" << nLanes << ": " << nMismatches << " mismatching components"
+            << ( nMismatches == 0 ? "  passed" : "  FAILED" ) << std::endl;
+  return nMismatches == 0;
+}
+
+int main( void )
+{
+  std::mt19937 generator( 42 );
+
+  bool passed = true;
+  passed &= check< 1 >( generator, 1000 );
+  passed &= check< 4 >( generator, 1000 );
+  passed &= check< 8 >( generator, 1000 );
+
+  return passed ? 0 : 1;
+}
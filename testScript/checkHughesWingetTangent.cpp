@@ -0,0 +1,50 @@
+/*
+ * Check of the closed form algorithmic tangent of HughesWinget, written directly into a 6x3x3 buffer, against the
+ * reference implementation based on the full tensor contractions, for random deformation gradients, stresses and
+ * Jaumann tangents.
+ *
+ * g++ -o checkHughesWingetTangent checkHughesWingetTangent.cpp -lMarmot
+ */
+#include "Marmot/HughesWinget.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace Marmot::NumericalAlgorithms;
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( -0.2, 0.2 );
+
+  double maxRelativeError = 0;
+  for ( int sample = 0; sample < 1000; sample++ ) {
+    const Matrix3d FOld = Matrix3d::Identity() + Matrix3d::NullaryExpr( [&]() { return random( generator ); } );
+    const Matrix3d FNew = FOld + 0.1 * Matrix3d::NullaryExpr( [&]() { return random( generator ); } );
+    const Vector6d stress = Vector6d::NullaryExpr( [&]() { return 1000 * random( generator ); } );
+    const Matrix6d dStressDStrain = Matrix6d::NullaryExpr( [&]() { return 1e5 * random( generator ); } );
+
+    HughesWinget hughesWinget( FOld, FNew, HughesWinget::Formulation::AbaqusLike );
+
+    const EigenTensors::Tensor633d reference = hughesWinget.compute_dS_dF( stress, FNew.inverse(), dStressDStrain );
+
+    double closedForm[54];
+    hughesWinget.compute_dS_dF( closedForm, stress, FNew.inverse(), dStressDStrain );
+
+    // both are stored column major, with the Voigt index running fastest
+    const Map< const Matrix< double, 54, 1 > > referenceValues( reference.data() );
+    const Map< const Matrix< double, 54, 1 > > closedFormValues( closedForm );
+
+    maxRelativeError = std::max( maxRelativeError,
+                                 ( closedFormValues - referenceValues ).cwiseAbs().maxCoeff() /
+                                   referenceValues.cwiseAbs().maxCoeff() );
+  }
+
+  const bool passed = maxRelativeError <= 1e-13;
+  std::cout << "closed form vs. reference tangent: maximum relative error " << maxRelativeError
+            << ( passed ? "  passed" : "  FAILED" ) << std::endl;
+
+  return passed ? 0 : 1;
+}
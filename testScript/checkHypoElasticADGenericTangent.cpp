@@ -0,0 +1,99 @@
+/*
+ * Check of the single evaluation tangent of MarmotMaterialHypoElasticADGeneric, which seeds all six strain directions
+ * at once, against the jacobian based MarmotMaterialHypoElasticAD::computeStress, for a nonlinear material with a
+ * state variable and random strain increments.
+ *
+ * g++ -o checkHypoElasticADGenericTangent checkHypoElasticADGenericTangent.cpp -lMarmot
+ */
+#include "Marmot/MarmotMaterialHypoElasticAD.h"
+#include "benchmarkUtility.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace BenchmarkUtility;
+
+double value( double x ) { return x; }
+double value( const autodiff::dual& x ) { return autodiff::val( x ); }
+template < typename Derivatives >
+double value( const AutoDiffScalar< Derivatives >& x )
+{
+  return x.value();
+}
+
+/// Isotropic elasticity with a nonlinear term, which softens with the accumulated strain increment norm kappa
+class NonlinearMaterial : public MarmotMaterialHypoElasticADGeneric< NonlinearMaterial > {
+
+public:
+  using MarmotMaterialHypoElasticADGeneric< NonlinearMaterial >::MarmotMaterialHypoElasticADGeneric;
+
+  int getNumberOfRequiredStateVars() override { return 1; }
+
+  StateView getStateView( const std::string& ) override { return { stateVars, 1 }; }
+
+  template < typename T >
+  void computeStressADGeneric( T* stress, const T* dStrain, const double*, const double, double& )
+  {
+    using std::sqrt;
+
+    const double lambda = 400, G = 300, H = 5e4;
+    double&      kappa  = stateVars[0];
+
+    T trace = dStrain[0] + dStrain[1] + dStrain[2];
+    T norm2 = T( 1e-12 );
+    for ( int i = 0; i < 6; i++ )
+      norm2 += dStrain[i] * dStrain[i];
+    const T norm = sqrt( norm2 );
+
+    for ( int i = 0; i < 6; i++ ) {
+      stress[i] += ( i < 3 ? 2 * G : G ) * dStrain[i] + H / ( 1 + 100 * kappa ) * norm * dStrain[i];
+      if ( i < 3 )
+        stress[i] += lambda * trace;
+    }
+
+    kappa += value( norm );
+  }
+};
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( -1e-3, 1e-3 );
+
+  double stateVar = 0, stateVarReference = 0;
+
+  NonlinearMaterial material( nullptr, 0, 0 );
+  NonlinearMaterial reference( nullptr, 0, 0 );
+  material.assignStateVars( &stateVar, 1 );
+  reference.assignStateVars( &stateVarReference, 1 );
+
+  Vector6d stress = Vector6d::Zero(), stressReference = Vector6d::Zero();
+
+  double stressDeviation = 0, tangentDeviation = 0, stateDeviation = 0;
+  for ( int increment = 0; increment < 100; increment++ ) {
+    const Vector6d dStrain = Vector6d::NullaryExpr( [&]() { return random( generator ); } );
+    Matrix6d       tangent, tangentReference;
+    double         pNewDT = 1, pNewDTReference = 1;
+
+    material.computeStress( stress.data(), tangent.data(), dStrain.data(), nullptr, 1.0, pNewDT );
+    reference.MarmotMaterialHypoElasticAD::computeStress( stressReference.data(),
+                                                          tangentReference.data(),
+                                                          dStrain.data(),
+                                                          nullptr,
+                                                          1.0,
+                                                          pNewDTReference );
+
+    stressDeviation  = std::max( stressDeviation, maximumDeviation( stress, stressReference ) );
+    tangentDeviation = std::max( tangentDeviation, maximumDeviation( tangent, tangentReference ) );
+    stateDeviation   = std::max( stateDeviation, std::abs( stateVar - stateVarReference ) );
+  }
+
+  bool passed = true;
+  passed &= check( "stress vs. jacobian based evaluation", stressDeviation, 1e-12 );
+  passed &= check( "tangent vs. jacobian based evaluation", tangentDeviation, 1e-12 );
+  passed &= check( "state variable vs. jacobian based evaluation", stateDeviation, 1e-14 );
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+/*
+ * Check of the runtime verification of analytic tangents in MarmotMaterialHypoElasticADSelectable, by a material with
+ * a deliberately wrong analytic tangent:
+ *  - without sampling, the AD path is never evaluated,
+ *  - with sampling, every samplingInterval-th call is checked and reported as mismatch,
+ *  - the state variables equal those of a purely analytic run, although the AD path updates them as well,
+ *  - a call which requests a cutback is not counted as check.
+ *
+ * g++ -o checkHypoElasticADTangentVerification checkHypoElasticADTangentVerification.cpp -lMarmot
+ */
+#include "Marmot/MarmotMaterialHypoElasticAD.h"
+#include "benchmarkUtility.h"
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace BenchmarkUtility;
+
+/// Linear elasticity accumulating the strain increment norm, whose analytic tangent is 10% too stiff
+class WrongTangentMaterial
+  : public MarmotMaterialHypoElasticADSelectable< WrongTangentMaterial, TangentMode::Analytic > {
+
+public:
+  using MarmotMaterialHypoElasticADSelectable< WrongTangentMaterial,
+                                               TangentMode::Analytic >::MarmotMaterialHypoElasticADSelectable;
+
+  static constexpr double E = 1000, cutbackStrain = 1.0;
+
+  inline static long nADEvaluations = 0;
+
+  int getNumberOfRequiredStateVars() override { return 1; }
+
+  StateView getStateView( const std::string& ) override { return { stateVars, 1 }; }
+
+  void computeStressAD( autodiff::dual*       stress,
+                        const autodiff::dual* dStrain,
+                        const double*,
+                        const double,
+                        double& pNewDT ) override
+  {
+    nADEvaluations++;
+
+    double norm2 = 0;
+    for ( int i = 0; i < 6; i++ ) {
+      stress[i] += E * dStrain[i];
+      norm2 += autodiff::val( dStrain[i] ) * autodiff::val( dStrain[i] );
+    }
+
+    stateVars[0] += std::sqrt( norm2 );
+    if ( std::sqrt( norm2 ) > cutbackStrain )
+      pNewDT = 0.5;
+  }
+
+  void computeStressAnalytic( double*       stress,
+                              double*       dStressDDStrain,
+                              const double* dStrain,
+                              const double*,
+                              const double,
+                              double& pNewDT ) override
+  {
+    const Map< const Vector6d > dE( dStrain );
+    Map< Vector6d >             S( stress );
+    Map< Matrix6d >             C( dStressDDStrain );
+
+    S += E * dE;
+    C = 1.1 * E * Matrix6d::Identity();
+
+    stateVars[0] += dE.norm();
+    if ( dE.norm() > cutbackStrain )
+      pNewDT = 0.5;
+  }
+};
+
+/// number of calls of computeStress, which evaluated the AD path (once per strain direction or at once)
+long nCallsWithADEvaluation = 0;
+
+/// Run nCalls increments with the given sampling interval and return the state variable after each call
+std::vector< double > run( int samplingInterval, int nCalls )
+{
+  WrongTangentMaterial::tangentVerification.samplingInterval = samplingInterval;
+
+  double                stateVar = 0;
+  WrongTangentMaterial  material( nullptr, 0, 0 );
+  std::vector< double > stateVarHistory;
+  Vector6d              stress = Vector6d::Zero();
+  Matrix6d              tangent;
+  material.assignStateVars( &stateVar, 1 );
+
+  for ( int i = 0; i < nCalls; i++ ) {
+    const Vector6d dStrain        = Vector6d::Constant( 1e-3 * std::sin( i + 1 ) );
+    double         pNewDT         = 1;
+    const long     nADEvaluations = WrongTangentMaterial::nADEvaluations;
+
+    material.computeStress( stress.data(), tangent.data(), dStrain.data(), nullptr, 1.0, pNewDT );
+
+    if ( WrongTangentMaterial::nADEvaluations > nADEvaluations )
+      nCallsWithADEvaluation++;
+    stateVarHistory.push_back( stateVar );
+  }
+
+  return stateVarHistory;
+}
+
+bool checkCount( const std::string& name, long count, long expected )
+{
+  return check( name + " (expected " + std::to_string( expected ) + ", got " + std::to_string( count ) + ")",
+                std::abs( count - expected ),
+                0 );
+}
+
+int main( void )
+{
+  auto& verification = WrongTangentMaterial::tangentVerification;
+
+  bool passed = true;
+
+  // without sampling, the AD path must not be evaluated at all
+  const std::vector< double > analytic = run( 0, 50 );
+  passed &= checkCount( "calls with AD evaluation without sampling", nCallsWithADEvaluation, 0 );
+  passed &= checkCount( "checks without sampling", verification.nChecks, 0 );
+
+  // every 5th call is checked, each check is a mismatch; the state must not be affected by the AD evaluations
+  const std::vector< double > sampled = run( 5, 50 );
+  passed &= checkCount( "calls with AD evaluation", nCallsWithADEvaluation, 10 );
+  passed &= checkCount( "checks", verification.nChecks, 10 );
+  passed &= checkCount( "mismatches", verification.nMismatches, 10 );
+
+  double stateDeviation = 0;
+  for ( size_t i = 0; i < analytic.size(); i++ )
+    stateDeviation = std::max( stateDeviation, std::abs( sampled[i] - analytic[i] ) );
+  passed &= check( "state variables vs. purely analytic run", stateDeviation, 0 );
+
+  // a sampled call requesting a cutback is evaluated by both paths, but not counted as check
+  verification.samplingInterval = 1;
+  double               stateVar = 0, pNewDT = 1;
+  WrongTangentMaterial material( nullptr, 0, 0 );
+  Vector6d             stress  = Vector6d::Zero();
+  const Vector6d       dStrain = Vector6d::Constant( 2 * WrongTangentMaterial::cutbackStrain );
+  Matrix6d             tangent;
+  material.assignStateVars( &stateVar, 1 );
+
+  const long nChecksBefore = verification.nChecks;
+  material.computeStress( stress.data(), tangent.data(), dStrain.data(), nullptr, 1.0, pNewDT );
+  passed &= checkCount( "checks of a call with cutback", verification.nChecks - nChecksBefore, 0 );
+  passed &= check( "pNewDT of a call with cutback vs. 0.5", std::abs( pNewDT - 0.5 ), 0 );
+
+  return passed ? 0 : 1;
+}
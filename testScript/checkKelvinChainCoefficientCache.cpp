@@ -0,0 +1,66 @@
+/*
+ * Check of the Kelvin chain evaluation with coefficients from a thread local CoefficientCache against the evaluation
+ * based on the time increment, for alternating substep sizes as in adaptive substepping. Moreover, it is checked that
+ * the cache neither recomputes nor reallocates the coefficients of recurring substep sizes.
+ *
+ * g++ -o checkKelvinChainCoefficientCache checkKelvinChainCoefficientCache.cpp -lMarmot
+ */
+#include "Marmot/MarmotKelvinChain.h"
+#include "benchmarkUtility.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace Marmot;
+using namespace Marmot::Materials;
+using namespace Eigen;
+using namespace BenchmarkUtility;
+
+int main( void )
+{
+  const KelvinChain::Properties retardationTimes = KelvinChain::generateRetardationTimes( 16, 1e-3, 3. );
+  const KelvinChain::Properties elasticModuli    = KelvinChain::Properties::LinSpaced( 16, 1e3, 1e4 );
+  const Matrix6d                unitCompliance   = Matrix6d::Identity();
+
+  thread_local KelvinChain::CoefficientCache cache;
+
+  KelvinChain::StateVarMatrix stateVars       = KelvinChain::StateVarMatrix::Zero( 6, 16 );
+  KelvinChain::StateVarMatrix stateVarsCached = KelvinChain::StateVarMatrix::Zero( 6, 16 );
+
+  // substep sizes as in adaptive substepping, where a few sizes recur
+  const double substepSizes[] = { 1e-2, 5e-3, 2.5e-3, 5e-3, 1e-2, 1e-2, 2.5e-3 };
+
+  double      deviation            = 0;
+  const void* lambdaOfFirstSubstep = nullptr;
+  for ( int i = 0; i < 70; i++ ) {
+    const double   dT      = substepSizes[i % 7];
+    const Vector6d dStress = Vector6d::Constant( std::sin( i ) );
+
+    const KelvinChain::Coefficients& coefficients = cache.get( dT, retardationTimes );
+    if ( i == 0 )
+      lambdaOfFirstSubstep = coefficients.lambda.data();
+    // the first substep size is cached in the first entry, which must be neither recomputed nor reallocated
+    if ( dT == substepSizes[0] && coefficients.lambda.data() != lambdaOfFirstSubstep )
+      deviation = std::numeric_limits< double >::infinity();
+
+    double   compliance = 0, complianceCached = 0;
+    Vector6d dStrain = Vector6d::Zero(), dStrainCached = Vector6d::Zero();
+
+    KelvinChain::evaluateKelvinChain( dT, elasticModuli, retardationTimes, stateVars, compliance, dStrain, 1.0 );
+    KelvinChain::evaluateKelvinChain( coefficients,
+                                      elasticModuli,
+                                      stateVarsCached,
+                                      complianceCached,
+                                      dStrainCached,
+                                      1.0 );
+    KelvinChain::updateStateVarMatrix( dT, elasticModuli, retardationTimes, stateVars, dStress, unitCompliance );
+    KelvinChain::updateStateVarMatrix( coefficients, elasticModuli, stateVarsCached, dStress, unitCompliance );
+
+    deviation = std::max( { deviation,
+                            std::abs( complianceCached - compliance ) / compliance,
+                            maximumDeviation( dStrainCached, dStrain ),
+                            maximumDeviation( stateVarsCached, stateVars ) } );
+  }
+
+  return check( "cached coefficients vs. time increment based evaluation", deviation, 1e-14 ) ? 0 : 1;
+}
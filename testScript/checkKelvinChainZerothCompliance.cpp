@@ -0,0 +1,42 @@
+/*
+ * Check of the zeroth compliance of a Kelvin chain against the exact integral of the Post-Widder retardation spectrum of
+ * a power law compliance function, phi(t) = t^n, for which L_k(tau) = c tau^n with
+ * c = -(-1)^k k^n n (n-1) ... (n-k+1) / (k-1)!.
+ *
+ * g++ -o checkKelvinChainZerothCompliance checkKelvinChainZerothCompliance.cpp -lMarmot
+ */
+#include "Marmot/MarmotKelvinChain.h"
+#include <cmath>
+#include <iostream>
+
+using namespace Marmot::Materials;
+
+constexpr double n = 0.5;
+
+template < int k >
+bool check( double tauMin )
+{
+  const auto phi = []( autodiff::Real< k, double > t ) { return pow( t, n ); };
+
+  double c = -std::pow( -1., k ) * std::pow( k, n ) / std::tgamma( k );
+  for ( int i = 0; i < k; i++ )
+    c *= n - i;
+
+  const double exact    = c / n * ( std::pow( tauMin / std::sqrt( 10. ), n ) - std::pow( 1e-14, n ) );
+  const double computed = KelvinChain::approximateZerothCompliance< k >( phi, tauMin );
+  const bool   passed   = std::abs( computed - exact ) <= 1e-3 * std::abs( exact );
+
+  std::cout << "k=" << k << ", tauMin=" << tauMin << ": computed " << computed << ", exact " << exact
+            << ( passed ? "  passed" : "  FAILED" ) << std::endl;
+  return passed;
+}
+
+int main( void )
+{
+  bool passed = true;
+  for ( const double tauMin : { 1e-4, 1e-1, 1e2 } ) {
+    passed &= check< 2 >( tauMin );
+    passed &= check< 3 >( tauMin );
+  }
+  return passed ? 0 : 1;
+}
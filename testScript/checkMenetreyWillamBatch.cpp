@@ -0,0 +1,119 @@
+/*
+ * Check of the batched Menetrey-Willam yield function and its derivatives against the scalar implementation for random
+ * Haigh-Westergaard coordinates, for all reductions of the failure criterion with and without the fillet parameter.
+ * The second derivatives of the batched evaluation are checked against central differences of the scalar first
+ * derivatives.
+ *
+ * g++ -o checkMenetreyWillamBatch checkMenetreyWillamBatch.cpp -lMarmot
+ */
+#include "Marmot/MenetreyWillam.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace Marmot::ContinuumMechanics::HaighWestergaard;
+using namespace Marmot::ContinuumMechanics::CommonConstitutiveModels;
+
+double relativeError( double a, double b )
+{
+  return std::abs( a - b ) / std::max( 1.0, std::max( std::abs( a ), std::abs( b ) ) );
+}
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( 0.0, 1.0 );
+
+  // an odd size, such that the remainder of the chunked processing is covered as well
+  const int n = 1001;
+
+  ArrayXd xi( n ), rho( n ), theta( n );
+  for ( int i = 0; i < n; i++ ) {
+    xi( i )    = -60 + 70 * random( generator );
+    rho( i )   = 0.01 + 40 * random( generator );
+    theta( i ) = Constants::Pi / 3 * random( generator );
+  }
+
+  const MenetreyWillam::MenetreyWillamType types[] = { MenetreyWillam::MenetreyWillamType::Mises,
+                                                       MenetreyWillam::MenetreyWillamType::Rankine,
+                                                       MenetreyWillam::MenetreyWillamType::DruckerPrager,
+                                                       MenetreyWillam::MenetreyWillamType::MohrCoulomb };
+
+  double maxError = 0, maxErrorSecondDerivatives = 0;
+
+  for ( const auto type : types ) {
+    const MenetreyWillam mw( 3.0, type, 30.0 );
+
+    for ( const double varEps : { 0.0, 0.1 } ) {
+      ArrayXd f( n ), dF_dXi( n ), dF_dRho( n ), dF_dTheta( n );
+      ArrayXd f2( n ), dF_dXi2( n ), dF_dRho2( n ), dF_dTheta2( n ), d2F_dRho2( n ), d2F_dRho_dTheta( n ),
+        d2F_dTheta2( n );
+      ArrayXd fOnly( n );
+
+      mw.yieldFunctionBatch( xi, rho, theta, fOnly, varEps );
+      mw.dYieldFunction_dHaighWestergaardBatch( xi, rho, theta, f, dF_dXi, dF_dRho, dF_dTheta, varEps );
+      mw.d2YieldFunction_dHaighWestergaard2Batch( xi,
+                                                  rho,
+                                                  theta,
+                                                  f2,
+                                                  dF_dXi2,
+                                                  dF_dRho2,
+                                                  dF_dTheta2,
+                                                  d2F_dRho2,
+                                                  d2F_dRho_dTheta,
+                                                  d2F_dTheta2,
+                                                  varEps );
+
+      for ( int i = 0; i < n; i++ ) {
+        const HaighWestergaardCoordinates< double > hw{ xi( i ), rho( i ), theta( i ) };
+
+        const double f_                           = mw.yieldFunction( hw, varEps );
+        const auto [dFdXi_, dFdRho_, dFdTheta_]   = mw.dYieldFunction_dHaighWestergaard( hw, varEps );
+        const double scalar[]                     = { f_, dFdXi_, dFdRho_, dFdTheta_ };
+        const double batch[]                      = { fOnly( i ), dF_dXi( i ), dF_dRho( i ), dF_dTheta( i ) };
+        const double batchWithSecondDerivatives[] = { f2( i ), dF_dXi2( i ), dF_dRho2( i ), dF_dTheta2( i ) };
+
+        maxError = std::max( maxError, relativeError( f( i ), f_ ) );
+        for ( int j = 0; j < 4; j++ ) {
+          maxError = std::max( maxError, relativeError( batch[j], scalar[j] ) );
+          maxError = std::max( maxError, relativeError( batchWithSecondDerivatives[j], scalar[j] ) );
+        }
+
+        const double h = 1e-6;
+        const auto [dXi_pRho, dRho_pRho, dTheta_pRho] = mw.dYieldFunction_dHaighWestergaard(
+          HaighWestergaardCoordinates< double >{ xi( i ), rho( i ) + h, theta( i ) },
+          varEps );
+        const auto [dXi_mRho, dRho_mRho, dTheta_mRho] = mw.dYieldFunction_dHaighWestergaard(
+          HaighWestergaardCoordinates< double >{ xi( i ), rho( i ) - h, theta( i ) },
+          varEps );
+        const auto [dXi_pTheta, dRho_pTheta, dTheta_pTheta] = mw.dYieldFunction_dHaighWestergaard(
+          HaighWestergaardCoordinates< double >{ xi( i ), rho( i ), theta( i ) + h },
+          varEps );
+        const auto [dXi_mTheta, dRho_mTheta, dTheta_mTheta] = mw.dYieldFunction_dHaighWestergaard(
+          HaighWestergaardCoordinates< double >{ xi( i ), rho( i ), theta( i ) - h },
+          varEps );
+
+        maxErrorSecondDerivatives = std::max( maxErrorSecondDerivatives,
+                                              relativeError( d2F_dRho2( i ), ( dRho_pRho - dRho_mRho ) / ( 2 * h ) ) );
+        maxErrorSecondDerivatives = std::max( maxErrorSecondDerivatives,
+                                              relativeError( d2F_dRho_dTheta( i ),
+                                                             ( dRho_pTheta - dRho_mTheta ) / ( 2 * h ) ) );
+        maxErrorSecondDerivatives = std::max( maxErrorSecondDerivatives,
+                                              relativeError( d2F_dTheta2( i ),
+                                                             ( dTheta_pTheta - dTheta_mTheta ) / ( 2 * h ) ) );
+      }
+    }
+  }
+
+  const bool passed = maxError < 1e-14 && maxErrorSecondDerivatives < 1e-6;
+
+  std::cout << "maximum relative deviation from the scalar evaluation: " << maxError << std::endl;
+  std::cout << "maximum relative deviation of the second derivatives from central differences: "
+            << maxErrorSecondDerivatives << std::endl;
+  std::cout << ( passed ? "passed" : "FAILED" ) << std::endl;
+
+  return passed ? 0 : 1;
+}
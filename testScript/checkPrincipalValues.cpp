@@ -0,0 +1,88 @@
+/*
+ * Check of the closed form principal values and directions against Eigen's SelfAdjointEigenSolver for random, nearly
+ * repeated and hydrostatic stress states, and of the analytic derivatives of the principal stresses against central
+ * differences.
+ *
+ * g++ -o checkPrincipalValues checkPrincipalValues.cpp -lMarmot
+ */
+#include "Marmot/MarmotTypedefs.h"
+#include "Marmot/MarmotVoigt.h"
+#include "benchmarkUtility.h"
+#include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace Marmot;
+using namespace Eigen;
+using namespace Marmot::ContinuumMechanics::VoigtNotation;
+using namespace BenchmarkUtility;
+
+int main( void )
+{
+  std::mt19937                             generator( 42 );
+  std::uniform_real_distribution< double > random( -100, 100 );
+
+  // random states, states with two nearly repeated principal stresses and hydrostatic states
+  std::vector< Vector6d > stresses;
+  for ( int i = 0; i < 10000; i++ )
+    stresses.push_back( Vector6d::NullaryExpr( [&]() { return random( generator ); } ) );
+  for ( int i = 0; i < 10000; i++ ) {
+    const Matrix3d Q = Quaterniond::UnitRandom().toRotationMatrix();
+    const double   a = random( generator ), b = random( generator );
+    const Vector3d d( a, b, b * ( 1 + 1e-10 * random( generator ) ) );
+    stresses.push_back( stressToVoigt( Matrix3d( Q * d.asDiagonal() * Q.transpose() ) ) );
+  }
+  for ( int i = 0; i < 100; i++ ) {
+    Vector6d stress = Vector6d::Zero();
+    stress.head( 3 ).setConstant( random( generator ) );
+    stresses.push_back( stress );
+  }
+
+  double valueDeviation = 0, reconstructionDeviation = 0, orthogonalityDeviation = 0;
+  for ( const Vector6d& stress : stresses ) {
+    const Matrix3d                     sigma = voigtToStress( stress );
+    SelfAdjointEigenSolver< Matrix3d > es( sigma );
+
+    // the absolute errors scale with the magnitude of the stress
+    const double scale = std::max( 1.0, sigma.norm() );
+
+    const Vector3d values = Invariants::principalStresses( stress );
+    const Matrix3d Q      = Invariants::principalStressesDirections( stress );
+
+    valueDeviation          = std::max( valueDeviation, ( values - es.eigenvalues() ).cwiseAbs().maxCoeff() / scale );
+    reconstructionDeviation = std::max( reconstructionDeviation,
+                                        ( Q * values.asDiagonal() * Q.transpose() - sigma ).cwiseAbs().maxCoeff() /
+                                          scale );
+    orthogonalityDeviation  = std::max( orthogonalityDeviation,
+                                       ( Q.transpose() * Q - Matrix3d::Identity() ).cwiseAbs().maxCoeff() );
+  }
+
+  // the derivatives are unique for distinct principal stresses only
+  double derivativeDeviation = 0;
+  for ( size_t i = 0; i < 1000; i++ ) {
+    const Vector6d& stress = stresses[i];
+    const Matrix36  dS_dS  = Derivatives::dStressPrincipals_dStress( stress );
+
+    Matrix36     dS_dSNumerical;
+    const double h = 1e-5;
+    for ( int j = 0; j < 6; j++ ) {
+      Vector6d stressPlus = stress, stressMinus = stress;
+      stressPlus( j ) += h;
+      stressMinus( j ) -= h;
+      dS_dSNumerical.col( j ) = ( Invariants::principalStresses( stressPlus ) -
+                                  Invariants::principalStresses( stressMinus ) ) /
+                                ( 2 * h );
+    }
+
+    derivativeDeviation = std::max( derivativeDeviation, maximumDeviation( dS_dS, dS_dSNumerical ) );
+  }
+
+  bool passed = true;
+  passed &= check( "principal values vs. SelfAdjointEigenSolver", valueDeviation, 1e-14 );
+  passed &= check( "principal directions, reconstruction", reconstructionDeviation, 1e-14 );
+  passed &= check( "principal directions, orthogonality", orthogonalityDeviation, 1e-14 );
+  passed &= check( "dStressPrincipals_dStress vs. central differences", derivativeDeviation, 1e-6 );
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+/*
+ * Check of the Prony series kernels against a per component reference implementation of the exponential algorithm,
+ * for a non-symmetric series with a random loading history, with and without an increment plan. The kernels for
+ * scalar relaxation times and for isotropic terms are checked against the general kernel for an equivalent series.
+ *
+ * g++ -o checkPronySeries checkPronySeries.cpp -lMarmot
+ */
+#include "Marmot/MarmotPronySeries.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+using namespace Marmot;
+using namespace Marmot::Materials::PronySeries;
+
+/**
+ * Reference step: the state h_ij of a term is the stress in component i due to the strain in component j, which relaxes
+ * with the relaxation time tau_ij.
+ */
+void referenceStep( const Properties& props,
+                    Vector6d&         stress,
+                    StateVarMatrix&   stateVars,
+                    const Vector6d&   dStrain,
+                    double            dT )
+{
+  stress += props.ultimateStiffnessMatrix * dStrain;
+
+  for ( size_t k = 0; k < props.nPronyTerms; k++ )
+    for ( int i = 0; i < 6; i++ )
+      for ( int j = 0; j < 6; j++ ) {
+        const double tau   = props.pronyRelaxationTimes( i, 6 * k + j );
+        const double decay = tau != 0.0 ? std::exp( -dT / tau ) : 0.0;
+        double&      h     = stateVars( i, 6 * k + j );
+
+        const double dH = tau * props.pronyStiffnesses( i, 6 * k + j ) * ( 1 - decay ) / dT * dStrain( j ) -
+                          ( 1 - decay ) * h;
+        stress( i ) += dH;
+        h += dH;
+      }
+}
+
+Matrix6d isotropicStiffness( double K, double G )
+{
+  Matrix6d C                        = Matrix6d::Zero();
+  C.topLeftCorner< 3, 3 >().array() = K - 2. / 3 * G;
+  C.diagonal().head< 3 >().array() += 2 * G;
+  C.diagonal().tail< 3 >().array() += G;
+  return C;
+}
+
+bool report( const std::string& name, double error )
+{
+  const bool passed = error <= 1e-12;
+  std::cout << name << ": maximum error " << error << ( passed ? "  passed" : "  FAILED" ) << std::endl;
+  return passed;
+}
+
+/**
+ * The state of a term with a scalar relaxation time is its stress, i.e., the row sums of the state of the general
+ * kernel. The terms include pure bulk and pure shear terms and an inactive term.
+ */
+bool checkScalarRelaxationTimes()
+{
+  const int nTerms = 4;
+
+  Properties                     general;
+  ScalarRelaxationTimeProperties scalar;
+  IsotropicProperties            isotropic;
+
+  general.nPronyTerms = scalar.nPronyTerms = isotropic.nPronyTerms = nTerms;
+  general.ultimateStiffnessMatrix = scalar.ultimateStiffnessMatrix = isotropic.ultimateStiffnessMatrix =
+    isotropicStiffness( 100, 50 );
+
+  general.pronyStiffnesses.resize( 6, 6 * nTerms );
+  general.pronyRelaxationTimes.resize( 6, 6 * nTerms );
+  scalar.pronyStiffnesses.resize( 6, 6 * nTerms );
+  scalar.pronyRelaxationTimes.resize( nTerms );
+  isotropic.pronyBulkModuli.resize( nTerms );
+  isotropic.pronyShearModuli.resize( nTerms );
+  isotropic.pronyRelaxationTimes.resize( nTerms );
+
+  const double K[nTerms] = { 10, 20, 0, 40 }, G[nTerms] = { 7, 0, 21, 28 }, tau[nTerms] = { 0.01, 0.1, 1, 0 };
+  for ( int k = 0; k < nTerms; k++ ) {
+    general.pronyStiffnesses.block< 6, 6 >( 0, 6 * k ) = isotropicStiffness( K[k], G[k] );
+    general.pronyRelaxationTimes.block< 6, 6 >( 0, 6 * k ).setConstant( tau[k] );
+    scalar.pronyStiffnesses.block< 6, 6 >( 0, 6 * k ) = isotropicStiffness( K[k], G[k] );
+    scalar.pronyRelaxationTimes( k )                  = tau[k];
+    isotropic.pronyBulkModuli( k )                    = K[k];
+    isotropic.pronyShearModuli( k )                   = G[k];
+    isotropic.pronyRelaxationTimes( k )               = tau[k];
+  }
+
+  StateVarMatrix generalStateVars   = StateVarMatrix::Zero( 6, 6 * nTerms );
+  StateVarMatrix scalarStateVars    = StateVarMatrix::Zero( 6, nTerms );
+  StateVarMatrix isotropicStateVars = StateVarMatrix::Zero( 6, nTerms );
+
+  double stressError = 0, stiffnessError = 0, stateError = 0;
+  for ( int step = 0; step < 20; step++ ) {
+    const Vector6d dStrain = Vector6d::Random() * 1e-3;
+    const double   dT      = 0.05 * ( step + 1 );
+
+    Vector6d          generalStress   = Vector6d::Zero();
+    Vector6d          scalarStress    = Vector6d::Zero();
+    Vector6d          isotropicStress = Vector6d::Zero();
+    Matrix6d          generalTangent, scalarTangent, isotropicTangent;
+    mapStateVarMatrix generalMap( generalStateVars.data(), 6, 6 * nTerms );
+    mapStateVarMatrix scalarMap( scalarStateVars.data(), 6, nTerms );
+    mapStateVarMatrix isotropicMap( isotropicStateVars.data(), 6, nTerms );
+
+    evaluatePronySeries( general, generalStress, generalTangent, generalMap, dStrain, dT, true );
+    evaluatePronySeries( scalar, scalarStress, scalarTangent, scalarMap, dStrain, dT, step % 2 == 0 );
+    evaluatePronySeries( isotropic, isotropicStress, isotropicTangent, isotropicMap, dStrain, dT, step % 2 == 1 );
+    if ( step % 2 == 1 )
+      updateStateVars( scalar, scalarMap, dStrain, dT );
+    else
+      updateStateVars( isotropic, isotropicMap, dStrain, dT );
+
+    stressError = std::max( { stressError,
+                              ( scalarStress - generalStress ).cwiseAbs().maxCoeff(),
+                              ( isotropicStress - generalStress ).cwiseAbs().maxCoeff() } );
+    stiffnessError = std::max( { stiffnessError,
+                                 ( scalarTangent - generalTangent ).cwiseAbs().maxCoeff(),
+                                 ( isotropicTangent - generalTangent ).cwiseAbs().maxCoeff() } );
+
+    for ( int k = 0; k < nTerms; k++ ) {
+      const Vector6d generalTermStress = generalStateVars.block< 6, 6 >( 0, 6 * k ).rowwise().sum();
+
+      stateError = std::max( { stateError,
+                               ( scalarStateVars.col( k ) - generalTermStress ).cwiseAbs().maxCoeff(),
+                               ( isotropicStateVars.col( k ) - generalTermStress ).cwiseAbs().maxCoeff() } );
+    }
+  }
+
+  bool passed = true;
+  passed &= report( "scalar relaxation times and isotropic terms, stress", stressError );
+  passed &= report( "scalar relaxation times and isotropic terms, stiffness", stiffnessError );
+  passed &= report( "scalar relaxation times and isotropic terms, state variables", stateError );
+  return passed;
+}
+
+int main( void )
+{
+  const int nTerms = 3;
+
+  Properties props;
+  props.nPronyTerms             = nTerms;
+  props.ultimateStiffnessMatrix = Matrix6d::Random();
+  props.pronyStiffnesses        = Matrix< double, 6, -1 >::Random( 6, 6 * nTerms );
+  props.pronyRelaxationTimes    = ( Matrix< double, 6, -1 >::Random( 6, 6 * nTerms ).array() + 1.5 ).matrix();
+
+  // an inactive component
+  props.pronyRelaxationTimes( 2, 3 ) = 0.0;
+
+  StateVarMatrix stateVars          = StateVarMatrix::Zero( 6, 6 * nTerms );
+  StateVarMatrix plannedStateVars   = stateVars;
+  StateVarMatrix referenceStateVars = stateVars;
+
+  double stressError = 0, stateError = 0, planStressError = 0, planStiffnessError = 0, planStateError = 0;
+  for ( int step = 0; step < 10; step++ ) {
+    const Vector6d dStrain = Vector6d::Random() * 1e-3;
+    const double   dT      = 0.1 * ( step + 1 );
+
+    Vector6d          stress = Vector6d::Zero(), referenceStress = Vector6d::Zero();
+    Matrix6d          stiffness;
+    mapStateVarMatrix stateVarsMap( stateVars.data(), 6, 6 * nTerms );
+
+    // alternately update the state in the stress evaluation or separately
+    evaluatePronySeries( props, stress, stiffness, stateVarsMap, dStrain, dT, step % 2 == 0 );
+    if ( step % 2 == 1 )
+      updateStateVars( props, stateVarsMap, dStrain, dT );
+
+    // increment plan with a few trial strain increments, as in a Newton iteration, of which the last one is committed
+    Vector6d          plannedStress;
+    Matrix6d          plannedStiffness;
+    mapStateVarMatrix plannedStateVarsMap( plannedStateVars.data(), 6, 6 * nTerms );
+
+    const IncrementPlan plan = planIncrement( props, plannedStateVars, dT );
+    for ( int iteration = 1; iteration <= 3; iteration++ ) {
+      plannedStress.setZero();
+      evaluatePronySeries( plan, plannedStress, plannedStiffness, dStrain * iteration / 3. );
+    }
+    commitIncrement( plan, plannedStateVarsMap, dStrain );
+
+    referenceStep( props, referenceStress, referenceStateVars, dStrain, dT );
+
+    stressError        = std::max( stressError, ( stress - referenceStress ).cwiseAbs().maxCoeff() );
+    stateError         = std::max( stateError, ( stateVars - referenceStateVars ).cwiseAbs().maxCoeff() );
+    planStressError    = std::max( planStressError, ( plannedStress - referenceStress ).cwiseAbs().maxCoeff() );
+    planStiffnessError = std::max( planStiffnessError, ( plannedStiffness - stiffness ).cwiseAbs().maxCoeff() );
+    planStateError     = std::max( planStateError, ( plannedStateVars - referenceStateVars ).cwiseAbs().maxCoeff() );
+  }
+
+  bool passed = true;
+  passed &= report( "general kernel, stress", stressError );
+  passed &= report( "general kernel, state variables", stateError );
+  passed &= report( "increment plan, stress", planStressError );
+  passed &= report( "increment plan, stiffness", planStiffnessError );
+  passed &= report( "increment plan, state variables", planStateError );
+  passed &= checkScalarRelaxationTimes();
+
+  return passed ? 0 : 1;
+}
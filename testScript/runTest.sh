@@ -1,2 +1,13 @@
 g++ -o testBftMechanics testBftMechanics.cpp  -L../lib -lbftMechanics
 ./testBftMechanics
+
+# checks and benchmarks, which return nonzero if their results are wrong
+failed=0
+for source in check*.cpp benchmark*.cpp; do
+  program=${source%.cpp}
+  flags="-std=c++17 -O3"
+  # bitwise comparison of the scalar and the vectorized code, which must not be contracted differently
+  case $program in checkHughesWingetBatch) flags="$flags -ffp-contract=off" ;; esac
+  g++ $flags -I../include -o $program $source -L../lib -lMarmot && ./$program || failed=1
+done
+exit $failed